@@ -33,6 +33,8 @@ public class CowNodes : ModuleRules
 			{
 				"Projects",
 				"UnrealEd",
+				"EditorSubsystem",
+				"DeveloperSettings",
 				"UMG",
 				"Slate",
 				"SlateCore",
@@ -44,6 +46,7 @@ public class CowNodes : ModuleRules
 				"Kismet",
 				"KismetCompiler",
 				"AssetRegistry",
+				"Json",
 				"CowRuntime",
 				"ToolMenus"
 			}
@@ -0,0 +1,332 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowActorQueryBenchmarkCommandlet.h"
+
+// Engine
+#include "Camera/CameraTypes.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Engine.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+// Cow
+#include "CowActorIndexSubsystem.h"
+#include "CowAllocationCounter.h"
+#include "CowBenchmarkUtilities.h"
+#include "CowFunctionLibrary.h"
+#include "CowQueryKernels.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowActorQueryBenchmark, Log, All);
+
+namespace CowActorQueryBenchmark
+{
+	struct FClasses
+	{
+		UClass* Target = nullptr;
+		// Everything that isn't Target
+		TArray<UClass*> Fillers;
+	};
+
+	// Actors are spread over [-WorldHalfSize, WorldHalfSize] on every axis
+	constexpr double WorldHalfSize = 50000.0;
+
+	FClasses CreateClasses()
+	{
+		auto CreateCompiled = [](UClass* ParentClass, const TCHAR* AssetName)
+		{
+			UBlueprint* Blueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(ParentClass, AssetName);
+
+			// Spatial queries need a root component to get a location from
+			USimpleConstructionScript* ConstructionScript = Blueprint->SimpleConstructionScript;
+			if (ConstructionScript && ParentClass == AActor::StaticClass() && ConstructionScript->GetRootNodes().IsEmpty())
+			{
+				ConstructionScript->AddNode(ConstructionScript->CreateNode(USceneComponent::StaticClass(), TEXT("Root")));
+			}
+
+			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+			return Blueprint->GeneratedClass.Get();
+		};
+
+		UClass* BaseClass = CreateCompiled(AActor::StaticClass(), TEXT("BP_CowBenchmarkBase"));
+
+		FClasses Classes;
+		Classes.Target = CreateCompiled(BaseClass, TEXT("BP_CowBenchmarkTarget"));
+		Classes.Fillers = { AActor::StaticClass(), ATargetPoint::StaticClass(), BaseClass, CreateCompiled(BaseClass, TEXT("BP_CowBenchmarkSibling")) };
+		return Classes;
+	}
+
+	UWorld* CreateWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/ false, TEXT("CowActorQueryBenchmark"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		return World;
+	}
+
+	void DestroyWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	// Spreads targets evenly through the spawn order, so they don't end up in one contiguous chunk
+	int32 SpawnActors(UWorld* World, const FClasses& Classes, int32 ActorCount, double HitRatio)
+	{
+		const int32 TargetCount = FMath::Clamp(FMath::RoundToInt32(ActorCount * HitRatio / 100.0), 1, ActorCount);
+		const double TargetStep = static_cast<double>(ActorCount) / TargetCount;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+
+		FRandomStream RandomStream(ActorCount);
+
+		int32 SpawnedTargets = 0;
+		double NextTarget = 0.0;
+		for (int32 Index = 0; Index < ActorCount; ++Index)
+		{
+			const FTransform Transform(FVector(
+				RandomStream.FRandRange(-WorldHalfSize, WorldHalfSize),
+				RandomStream.FRandRange(-WorldHalfSize, WorldHalfSize),
+				RandomStream.FRandRange(-WorldHalfSize, WorldHalfSize)));
+
+			UClass* Class = nullptr;
+			if (SpawnedTargets < TargetCount && Index >= NextTarget)
+			{
+				Class = Classes.Target;
+				++SpawnedTargets;
+				NextTarget += TargetStep;
+			}
+			else
+			{
+				Class = Classes.Fillers[Index % Classes.Fillers.Num()];
+			}
+			World->SpawnActor(Class, &Transform, SpawnParameters);
+		}
+		return SpawnedTargets;
+	}
+
+	struct FQuery
+	{
+		const TCHAR* Name;
+		// Returns number of found actors
+		TFunction<int32()> Execute;
+	};
+
+	struct FResult
+	{
+		FString Query;
+		int32 ActorCount = 0;
+		double HitRatio = 0.0;
+		int32 Matches = 0;
+		TArray<double> Microseconds;
+		Cow::FAllocationCount Allocations;
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Query,ActorCount,HitRatio,Matches,Iterations,MedianUs,P99Us,MinUs,AllocationsPerCall,AllocatedBytesPerCall");
+		}
+
+		FString ToCsvRow() const
+		{
+			const double Calls = FMath::Max(Microseconds.Num(), 1);
+			return FString::Printf(TEXT("%s,%d,%g,%d,%d,%.3f,%.3f,%.3f,%.2f,%.1f"),
+				*Query, ActorCount, HitRatio, Matches, Microseconds.Num(),
+				FCowBenchmarkUtilities::Median(Microseconds), FCowBenchmarkUtilities::Percentile(Microseconds, 99.0), FMath::Min(Microseconds),
+				Allocations.Allocations / Calls, Allocations.Bytes / Calls);
+		}
+	};
+
+	FResult Measure(const FQuery& Query, int32 Iterations)
+	{
+		FResult Result;
+		Result.Query = Query.Name;
+
+		// Warm up (grows reused output arrays, touches actor hash buckets)
+		Result.Matches = Query.Execute();
+
+		Result.Microseconds.Reserve(Iterations);
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Cow::FScopedAllocationCounter AllocationCounter(Result.Allocations);
+			const double StartTime = FPlatformTime::Seconds();
+			Query.Execute();
+			Result.Microseconds.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+		}
+		return Result;
+	}
+
+	// Runs the kernel over every chunk of the target class, OutIndices is reused between calls
+	template<typename ShapeType>
+	int32 RunKernel(UWorld* World, const TSoftClassPtr<AActor>& SoftTarget, const ShapeType& Shape, bool bScalar, TArray<int32>& OutIndices)
+	{
+		int32 Matches = 0;
+		TCowActorView<AActor>(World, SoftTarget).ForEachChunk([&Shape, bScalar, &OutIndices, &Matches](const TCowActorChunk<AActor>& Chunk)
+		{
+			if (OutIndices.Num() < Chunk.Num())
+			{
+				OutIndices.SetNumUninitialized(Chunk.Num());
+			}
+			Matches += bScalar ? Cow::Kernels::Scalar::Filter(Chunk.GetPositions(), Shape, OutIndices.GetData())
+							   : Cow::Kernels::Filter(Chunk.GetPositions(), Shape, OutIndices.GetData());
+		});
+		return Matches;
+	}
+
+	// Every query benchmarked against the world, add new ones here
+	TArray<FQuery> MakeQueries(UWorld* World, const FClasses& Classes)
+	{
+		const TSoftClassPtr<AActor> SoftTarget(Classes.Target);
+		TSubclassOf<AActor> HardTarget(Classes.Target);
+
+		// Shared between calls like ubergraph persistent frame locals
+		TSharedRef<TArray<AActor*>> OutActors = MakeShared<TArray<AActor*>>();
+
+		TArray<FQuery> Queries;
+		// Iterations run in the same frame, so this one measures callers sharing the memoized result
+		Queries.Add({ TEXT("CowGetAllActorsOfClass"), [World, SoftTarget, OutActors]()
+		{
+			UCowFunctionLibrary::CowGetAllActorsOfClass(World, SoftTarget, *OutActors);
+			return OutActors->Num();
+		}});
+		Queries.Add({ TEXT("CowGetAllActorsOfClass (first in frame)"), [World, SoftTarget, OutActors]()
+		{
+			UCowActorIndexSubsystem::Get(World)->FlushQueryMemo();
+			UCowFunctionLibrary::CowGetAllActorsOfClass(World, SoftTarget, *OutActors);
+			return OutActors->Num();
+		}});
+		Queries.Add({ TEXT("CowGetActorOfClass (first in frame)"), [World, SoftTarget]()
+		{
+			UCowActorIndexSubsystem::Get(World)->FlushQueryMemo();
+			AActor* OutActor = nullptr;
+			UCowFunctionLibrary::CowGetActorOfClass(World, SoftTarget, OutActor);
+			return OutActor ? 1 : 0;
+		}});
+		Queries.Add({ TEXT("GameplayStatics::GetAllActorsOfClass"), [World, HardTarget, OutActors]()
+		{
+			UGameplayStatics::GetAllActorsOfClass(World, HardTarget, *OutActors);
+			return OutActors->Num();
+		}});
+
+		// Shapes cover a few percent of the world each, the frustum looks through the whole world from its edge
+		FCowQueryShape Sphere;
+		Sphere.Type = ECowQueryShapeType::Sphere;
+		Sphere.Radius = WorldHalfSize * 0.5;
+
+		FCowQueryShape Box;
+		Box.Type = ECowQueryShapeType::Box;
+		Box.Extent = FVector(WorldHalfSize * 0.4);
+
+		FCowQueryShape Cone;
+		Cone.Type = ECowQueryShapeType::Cone;
+		Cone.Origin = FVector(-WorldHalfSize, 0.0, 0.0);
+		Cone.Direction = FVector::ForwardVector;
+		Cone.Radius = WorldHalfSize * 2.0;
+		Cone.HalfAngleDegrees = 15.f;
+
+		FMinimalViewInfo View;
+		View.Location = FVector(-WorldHalfSize, 0.0, 0.0);
+		View.FOV = 60.f;
+		View.AspectRatio = 16.f / 9.f;
+
+		// Blueprint style: get all, then GetActorLocation and distance per actor
+		Queries.Add({ TEXT("Sphere: CowGetAllActorsOfClass + GetActorLocation"), [World, SoftTarget, OutActors, Sphere]()
+		{
+			UCowFunctionLibrary::CowGetAllActorsOfClass(World, SoftTarget, *OutActors);
+			int32 Matches = 0;
+			for (const AActor* Actor : *OutActors)
+			{
+				Matches += FVector::DistSquared(Actor->GetActorLocation(), Sphere.Origin) <= FMath::Square(Sphere.Radius);
+			}
+			return Matches;
+		}});
+
+		for (const FCowQueryShape& Shape : { Sphere, Box, Cone })
+		{
+			const TCHAR* Name = Shape.Type == ECowQueryShapeType::Sphere ? TEXT("Sphere: CowGetAllActorsOfClassInShape")
+							  : Shape.Type == ECowQueryShapeType::Box ? TEXT("Box: CowGetAllActorsOfClassInShape")
+							  : TEXT("Cone: CowGetAllActorsOfClassInShape");
+			Queries.Add({ Name, [World, SoftTarget, OutActors, Shape]()
+			{
+				UCowFunctionLibrary::CowGetAllActorsOfClassInShape(World, SoftTarget, Shape, *OutActors);
+				return OutActors->Num();
+			}});
+		}
+
+		TSharedRef<TArray<int32>> OutIndices = MakeShared<TArray<int32>>();
+		auto AddKernelQueries = [&Queries, World, SoftTarget, OutIndices](const TCHAR* ScalarName, const TCHAR* SimdName, const auto& KernelShape)
+		{
+			Queries.Add({ ScalarName, [World, SoftTarget, OutIndices, KernelShape]() { return RunKernel(World, SoftTarget, KernelShape, /*bScalar*/ true, *OutIndices); } });
+			Queries.Add({ SimdName, [World, SoftTarget, OutIndices, KernelShape]() { return RunKernel(World, SoftTarget, KernelShape, /*bScalar*/ false, *OutIndices); } });
+		};
+		AddKernelQueries(TEXT("Sphere: Kernel scalar"), TEXT("Sphere: Kernel SIMD"), Cow::Kernels::MakeSphere(Sphere.Origin, Sphere.Radius));
+		AddKernelQueries(TEXT("Box: Kernel scalar"), TEXT("Box: Kernel SIMD"), Cow::Kernels::MakeBox(Box.Origin, Box.Extent));
+		AddKernelQueries(TEXT("Cone: Kernel scalar"), TEXT("Cone: Kernel SIMD"), Cow::Kernels::MakeCone(Cone.Origin, Cone.Direction, Cone.Radius, Cone.HalfAngleDegrees));
+		AddKernelQueries(TEXT("Frustum: Kernel scalar"), TEXT("Frustum: Kernel SIMD"), Cow::Kernels::MakeFrustum(View));
+		return Queries;
+	}
+}
+
+UCowActorQueryBenchmarkCommandlet::UCowActorQueryBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Measures actor-of-class queries (Cow and stock) and shape filters (scalar and SIMD) in a headless world with up to 100k actors");
+	HelpUsage = TEXT("-run=CowActorQueryBenchmark [-ActorCounts=1000,10000,100000] [-HitRatios=0.1,10,100] [-Iterations=100] [-Output=<Path>.csv]");
+}
+
+int32 UCowActorQueryBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace CowActorQueryBenchmark;
+
+	const TArray<int32> ActorCounts = FCowBenchmarkUtilities::ParseIntList(Params, TEXT("ActorCounts="), { 1000, 10000, 100000 });
+	const TArray<double> HitRatios = FCowBenchmarkUtilities::ParseDoubleList(Params, TEXT("HitRatios="), { 0.1, 10.0, 100.0 });
+	int32 Iterations = 100;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	const FClasses Classes = CreateClasses();
+
+	if (!Cow::FScopedAllocationCounter::IsAvailable())
+	{
+		UE_LOG(LogCowActorQueryBenchmark, Warning, TEXT("Allocations can't be counted, GMalloc couldn't be wrapped"));
+	}
+
+	TArray<FString> Rows;
+	for (const int32 ActorCount : ActorCounts)
+	{
+		for (const double HitRatio : HitRatios)
+		{
+			UWorld* World = CreateWorld();
+			const int32 TargetCount = SpawnActors(World, Classes, ActorCount, HitRatio);
+
+			for (const FQuery& Query : MakeQueries(World, Classes))
+			{
+				FResult Result = Measure(Query, Iterations);
+				Result.ActorCount = ActorCount;
+				Result.HitRatio = HitRatio;
+
+				UE_LOG(LogCowActorQueryBenchmark, Display, TEXT("%-40s Actors=%-7d Hit=%-5g%% (%d) Matches=%-7d Median=%.2fus P99=%.2fus Allocs/call=%.2f"),
+					*Result.Query, ActorCount, HitRatio, TargetCount, Result.Matches,
+					FCowBenchmarkUtilities::Median(Result.Microseconds), FCowBenchmarkUtilities::Percentile(Result.Microseconds, 99.0),
+					static_cast<double>(Result.Allocations.Allocations) / Iterations);
+
+				Rows.Add(Result.ToCsvRow());
+			}
+
+			DestroyWorld(World);
+		}
+	}
+
+	const FString OutputPath = FCowBenchmarkUtilities::GetOutputPath(Params, TEXT("ActorQueryBenchmark.csv"));
+	return FCowBenchmarkUtilities::WriteCsv(OutputPath, FResult::GetCsvHeader(), Rows) ? 0 : 1;
+}
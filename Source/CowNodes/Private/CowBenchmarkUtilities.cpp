@@ -0,0 +1,108 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowBenchmarkUtilities.h"
+
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/FileManager.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowBenchmark, Log, All);
+
+TArray<int32> FCowBenchmarkUtilities::ParseIntList(const FString& Params, const TCHAR* Key, const TArray<int32>& Default)
+{
+	FString Value;
+	if (!FParse::Value(*Params, Key, Value, /*bShouldStopOnSeparator*/ false))
+	{
+		return Default;
+	}
+
+	TArray<FString> Tokens;
+	Value.ParseIntoArray(Tokens, TEXT(","));
+
+	TArray<int32> Result;
+	for (const FString& Token : Tokens)
+	{
+		if (Token.IsNumeric())
+		{
+			Result.Add(FCString::Atoi(*Token));
+		}
+	}
+	return Result.IsEmpty() ? Default : Result;
+}
+
+TArray<double> FCowBenchmarkUtilities::ParseDoubleList(const FString& Params, const TCHAR* Key, const TArray<double>& Default)
+{
+	FString Value;
+	if (!FParse::Value(*Params, Key, Value, /*bShouldStopOnSeparator*/ false))
+	{
+		return Default;
+	}
+
+	TArray<FString> Tokens;
+	Value.ParseIntoArray(Tokens, TEXT(","));
+
+	TArray<double> Result;
+	for (const FString& Token : Tokens)
+	{
+		if (Token.IsNumeric())
+		{
+			Result.Add(FCString::Atod(*Token));
+		}
+	}
+	return Result.IsEmpty() ? Default : Result;
+}
+
+double FCowBenchmarkUtilities::Percentile(TArray<double> Samples, double Percent)
+{
+	if (Samples.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	Samples.Sort();
+	const int32 Rank = FMath::CeilToInt32(FMath::Clamp(Percent, 0.0, 100.0) / 100.0 * Samples.Num());
+	return Samples[FMath::Clamp(Rank - 1, 0, Samples.Num() - 1)];
+}
+
+UBlueprint* FCowBenchmarkUtilities::CreateTransientBlueprint(UClass* ParentClass, const FString& AssetName, UClass* BlueprintClass, UClass* GeneratedClass)
+{
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/CowNodesBenchmark/%s"), *AssetName));
+	Package->SetFlags(RF_Transient);
+
+	return FKismetEditorUtilities::CreateBlueprint(ParentClass, Package, *AssetName, BPTYPE_Normal,
+												   BlueprintClass ? BlueprintClass : UBlueprint::StaticClass(),
+												   GeneratedClass ? GeneratedClass : UBlueprintGeneratedClass::StaticClass());
+}
+
+FString FCowBenchmarkUtilities::GetOutputPath(const FString& Params, const FString& DefaultFileName)
+{
+	FString OutputPath;
+	if (FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		return FPaths::ConvertRelativePathToFull(OutputPath);
+	}
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("CowNodes") / DefaultFileName);
+}
+
+bool FCowBenchmarkUtilities::WriteCsv(const FString& Path, const FString& Header, const TArray<FString>& Rows)
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), /*Tree*/ true);
+
+	FString Content = Header + LINE_TERMINATOR;
+	for (const FString& Row : Rows)
+	{
+		Content += Row + LINE_TERMINATOR;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Content, *Path))
+	{
+		UE_LOG(LogCowBenchmark, Error, TEXT("Failed to write %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogCowBenchmark, Display, TEXT("Results (%d rows) written to %s"), Rows.Num(), *Path);
+	return true;
+}
@@ -1,6 +1,7 @@
 // Copyright (c) 2025 Oleksandr "sleepCOW" Ozerov. All rights reserved.
 
 #include "CowCompilerUtilities.h"
+#include "CowExposedPropertyCache.h"
 
 #include "BlueprintCompilationManager.h"
 #include "K2Node_CallArrayFunction.h"
@@ -8,6 +9,7 @@
 #include "K2Node_DynamicCast.h"
 #include "K2Node_EnumLiteral.h"
 #include "KismetCompiler.h"
+#include "KismetCompiledFunctionContext.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 
 const UClass* FCowCompilerUtilities::GetFirstNativeClass(const UClass* Child)
@@ -25,14 +27,236 @@ UClass* FCowCompilerUtilities::GetFirstNativeClass(UClass* Child)
 	return const_cast<UClass*>(FCowCompilerUtilities::GetFirstNativeClass(const_cast<const UClass*>(Child)));
 }
 
+FCowCompilerUtilities::FExpansionStats& FCowCompilerUtilities::GetExpansionStats()
+{
+	static FExpansionStats Stats;
+	return Stats;
+}
+
+void FCowCompilerUtilities::SetNodeGuidPinDefault(const FKismetCompilerContext& CompilerContext, UEdGraphNode* IntermediateNode, const UEdGraphNode* SourceNode)
+{
+	if (UEdGraphPin* NodeGuidPin = IntermediateNode->FindPin(NodeGuidParamName, EGPD_Input))
+	{
+		CompilerContext.GetSchema()->TrySetDefaultValue(*NodeGuidPin, SourceNode->NodeGuid.ToString(EGuidFormats::Digits));
+	}
+}
+
+FBPTerminal* FCowCompilerUtilities::CreateNodeGuidLiteral(FKismetFunctionContext& Context, UEdGraphNode* Node)
+{
+	FBPTerminal* Term = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
+	Term->Type.PinCategory = UEdGraphSchema_K2::PC_Struct;
+	Term->Type.PinSubCategoryObject = TBaseStructure<FGuid>::Get();
+	Term->Name = Node->NodeGuid.ToString(EGuidFormats::Digits);
+	Term->Source = Node;
+	return Term;
+}
+
+bool FCowCompilerUtilities::IsExposedOnSpawnProperty(const FProperty* Property)
+{
+	const bool bIsDelegate = Property->IsA(FMulticastDelegateProperty::StaticClass());
+	const bool bIsExposedToSpawn = UEdGraphSchema_K2::IsPropertyExposedOnSpawn(Property);
+	const bool bIsSettableExternally = !Property->HasAnyPropertyFlags(CPF_DisableEditOnInstance);
+
+	return bIsExposedToSpawn &&
+		   !Property->HasAnyPropertyFlags(CPF_Parm) &&
+		   bIsSettableExternally &&
+		   Property->HasAllPropertyFlags(CPF_BlueprintVisible) &&
+		   !bIsDelegate &&
+		   FBlueprintEditorUtils::PropertyStillExists(Property);
+}
+
+UClass* FCowCompilerUtilities::GetClassFromSoftClassPin(const UEdGraphPin* SoftClassPin)
+{
+	// If SoftClassPin isn't connected to anything and not empty we should use Path written in DefaultValue
+	if (!SoftClassPin->DefaultValue.IsEmpty() && SoftClassPin->LinkedTo.Num() == 0)
+	{
+		FSoftObjectPath SoftClass = SoftClassPin->DefaultValue;
+		return Cast<UClass>(SoftClass.TryLoad());
+	}
+	else if (SoftClassPin->LinkedTo.Num())
+	{
+		UEdGraphPin* ClassSource = SoftClassPin->LinkedTo[0];
+		return Cast<UClass>(ClassSource->PinType.PinSubCategoryObject.Get());
+	}
+
+	return nullptr;
+}
+
+bool FCowCompilerUtilities::IsAnyInputExecPinsConnected(const TArray<UEdGraphPin*>& Pins, UEdGraphPin*& OutFirstUnconnectedPin)
+{
+	OutFirstUnconnectedPin = nullptr;
+
+	for (UEdGraphPin* Pin : Pins)
+	{
+		if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && Pin->Direction == EEdGraphPinDirection::EGPD_Input)
+		{
+			if (!Pin->LinkedTo.IsEmpty())
+			{
+				return true;
+			}
+			if (OutFirstUnconnectedPin == nullptr)
+			{
+				OutFirstUnconnectedPin = Pin;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FCowCompilerUtilities::AutoWireCompletedPin(UEdGraphPin* ResultPin, UEdGraphPin* CompletedPin)
+{
+	// See UK2Node_CowCreateWidgetAsync::PinConnectionListChanged for the original explanation
+	const bool bResultHasSingleConnection = ResultPin->LinkedTo.Num() == 1;
+	const bool bCompletedPinIsntConnected = CompletedPin->LinkedTo.IsEmpty();
+	if (bCompletedPinIsntConnected && bResultHasSingleConnection)
+	{
+		const UEdGraphNode* ResultConnectedNode = ResultPin->LinkedTo[0]->GetOwningNode();
+		UEdGraphPin* FirstAvailableExec = nullptr;
+		const bool bHasConnectedExecs = IsAnyInputExecPinsConnected(ResultConnectedNode->Pins, FirstAvailableExec);
+
+		// If the node doesn't have anything connected to execs and has available spot -> connect to it
+		if (!bHasConnectedExecs && FirstAvailableExec)
+		{
+			const UEdGraphSchema_K2* K2Schema = CastChecked<UEdGraphSchema_K2>(CompletedPin->GetSchema());
+			K2Schema->TryCreateConnection(CompletedPin, FirstAvailableExec);
+		}
+	}
+}
+
+bool FCowCompilerUtilities::IsThenAutoWireDisallowed(const UEdGraphPin* ThenPin, const UEdGraphPin* ResultPin, const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin)
+{
+	// See UK2Node_CowCreateWidgetAsync::IsConnectionDisallowed for the original explanation
+	if (MyPin == ThenPin && ResultPin->LinkedTo.Num() == 1)
+	{
+		UEdGraphNode* ReturnLinkedNode = ResultPin->LinkedTo[0]->GetOwningNode();
+		if (ReturnLinkedNode == OtherPin->GetOwningNode())
+		{
+			UEdGraphPin* NotUsed = nullptr;
+			return IsAnyInputExecPinsConnected(ReturnLinkedNode->Pins, NotUsed);
+		}
+	}
+	return false;
+}
+
+UClass* FCowCompilerUtilities::GetHardRefThroughSoftClassPin(const UEdGraphPin* SoftClassPin)
+{
+	if (SoftClassPin->LinkedTo.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	UClass* SourceClass = Cast<UClass>(SoftClassPin->LinkedTo[0]->PinType.PinSubCategoryObject.Get());
+	return SourceClass && !SourceClass->HasAnyClassFlags(CLASS_Native) ? SourceClass : nullptr;
+}
+
+void FCowCompilerUtilities::NoteHardRefThroughSoftClassPin(const FKismetCompilerContext& CompilerContext, const UEdGraphPin* SoftClassPin)
+{
+	if (UClass* SourceClass = GetHardRefThroughSoftClassPin(SoftClassPin))
+	{
+		// Let's be honest - I won't localize it, so fuck this LOCTEXT macro :)
+		CompilerContext.MessageLog.Note(*FString::Printf(TEXT("You introduced hard-ref to %s via @@ pin. Make sure it doesn't happened accidentally and you actually wanted it"), *SourceClass->GetName()), SoftClassPin->LinkedTo[0]);
+	}
+}
+
+void FCowCompilerUtilities::NoteSpawnVarPinsMatchingDefaults(const FKismetCompilerContext& CompilerContext, const UEdGraphNode* SpawnNode, const UClass* ClassToSpawn, TConstArrayView<FName> InternalPinNames)
+{
+	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+	auto DisplayNoteForPin = [&CompilerContext](UEdGraphPin* Pin)
+	{
+		CompilerContext.MessageLog.Note(*NSLOCTEXT("Cow", "CowSpawnVarPin_DefaultValueNote", "@@ pin's default value is equal to base class's default value which may indicate an error.").ToString(), Pin);
+	};
+
+	TSharedRef<const FCowClassExposedProperties> ExposedProperties = FCowExposedPropertyCache::Get().GetClassProperties(ClassToSpawn);
+
+	for (UEdGraphPin* Pin : SpawnNode->Pins)
+	{
+		// We need to check only pins generated for Exposed vars
+		// + we only care if default value is edited, any linked pins are out of the validation context
+		//	 because their values could be different at runtime
+		if (Pin && Pin->Direction == EGPD_Input && Pin->LinkedTo.IsEmpty())
+		{
+			if (InternalPinNames.Contains(Pin->PinName))
+			{
+				continue;
+			}
+
+			const FCowExposedProperty* ExposedProperty = ExposedProperties->Find(Pin->PinName);
+			if (!ExposedProperty)
+			{
+				continue;
+			}
+
+			FString DefaultValueErrorString = Schema->IsCurrentPinDefaultValid(Pin);
+			if (!DefaultValueErrorString.IsEmpty())
+			{
+				// Some types require a connection for assignment (e.g. arrays).
+				continue;
+			}
+			// We don't want to generate an assignment node unless the default value 
+			// differs from the value in the CDO:
+			FString DefaultValueAsString;
+			FCowExposedPropertyCache::GetDefaultValue(ClassToSpawn, *ExposedProperty, DefaultValueAsString);
+
+			// First check the string representation of the default value
+			if (Schema->DoesDefaultValueMatch(*Pin, DefaultValueAsString))
+			{
+				DisplayNoteForPin(Pin);
+				continue;
+			}
+
+			FString UseDefaultValue;
+			TObjectPtr<UObject> UseDefaultObject = nullptr;
+			FText UseDefaultText;
+			constexpr bool bPreserveTextIdentity = true;
+
+			// Next check if the converted default value would be the same to handle cases like None for object pointers
+			Schema->GetPinDefaultValuesFromString(Pin->PinType, Pin->GetOwningNodeUnchecked(), DefaultValueAsString, UseDefaultValue, UseDefaultObject, UseDefaultText, bPreserveTextIdentity);
+			if (Pin->DefaultValue.Equals(UseDefaultValue, ESearchCase::CaseSensitive) && Pin->DefaultObject == UseDefaultObject && Pin->DefaultTextValue.IdenticalTo(UseDefaultText))
+			{
+				DisplayNoteForPin(Pin);
+				continue;
+			}
+		}
+	}
+}
+
+bool FCowCompilerUtilities::ValidateSpawnVarPinsNameConflicts(const FKismetCompilerContext& CompilerContext, const UEdGraphNode* SpawnNode, const UClass* ClassToSpawn, TConstArrayView<FName> InternalPinNames)
+{
+	// If any exposed pins has conflicting name with internal pins it will cause problems
+	// Pins won't be shown
+	// Generation of assignments will be wrong
+	check(ClassToSpawn);
+
+	for (const FCowExposedProperty& ExposedProperty : FCowExposedPropertyCache::Get().GetClassProperties(ClassToSpawn)->Properties)
+	{
+		const FProperty* Property = ExposedProperty.Property;
+		int32 Index = InternalPinNames.Find(Property->GetFName());
+		if (const bool bPropertyNameIsConflictingWithInternalPins = Index != INDEX_NONE)
+		{
+			CompilerContext.MessageLog.Error(*FString::Printf(TEXT("@@ property %s from type %s has conflicting name with internal pin %s"),
+				*Property->GetName(), *GetNameSafe(ClassToSpawn), *InternalPinNames[Index].ToString()), SpawnNode);
+			return false;
+		}
+	}
+
+	return true;
+}
+
 UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UK2Node* CallBeginSpawnNode, UEdGraphNode* SpawnNode, UEdGraphPin* CallBeginResult, const UClass* ForClass, const UEdGraphPin* CallBeginClassInput)
+{
+	return GenerateAssignmentNodes(CompilerContext, SourceGraph, CallBeginSpawnNode, CallBeginSpawnNode->GetThenPin(), SpawnNode, CallBeginResult, ForClass, CallBeginClassInput);
+}
+
+UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UK2Node* CallBeginSpawnNode, UEdGraphPin* CallBeginThen, UEdGraphNode* SpawnNode, UEdGraphPin* CallBeginResult, const UClass* ForClass, const UEdGraphPin* CallBeginClassInput)
 {
 	static const FName ObjectParamName(TEXT("Object"));
 	static const FName ValueParamName(TEXT("Value"));
 	static const FName PropertyNameParamName(TEXT("PropertyName"));
 
 	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
-	UEdGraphPin* LastThen = CallBeginSpawnNode->GetThenPin();
+	UEdGraphPin* LastThen = CallBeginThen;
 
 	// If the class input pin is linked, then 'ForClass' represents a base type, but the actual type might be a derived class
 	// that won't get resolved until runtime. In that case, we can't use the base type's CDO to avoid generating assignment
@@ -40,6 +264,9 @@ UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerConte
 	// derived type might store a different default value, which would otherwise be used if we don't explicitly assign it.
 	const bool bIsClassInputPinLinked = CallBeginClassInput && CallBeginClassInput->LinkedTo.Num() > 0;
 
+	// Cow: exposed properties, setters and CDO default strings are shared between all nodes spawning ForClass
+	TSharedRef<const FCowClassExposedProperties> ExposedProperties = FCowExposedPropertyCache::Get().GetClassProperties(ForClass);
+
 	// Create 'set var by name' nodes and hook them up
 	for (int32 PinIdx = 0; PinIdx < SpawnNode->Pins.Num(); PinIdx++)
 	{
@@ -53,13 +280,14 @@ UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerConte
 		
 		if (!CallBeginSpawnNode->FindPin(OrgPin->PinName))
 		{
-			FProperty* Property = FindFProperty<FProperty>(ForClass, OrgPin->PinName);
+			const FCowExposedProperty* ExposedProperty = ExposedProperties->Find(OrgPin->PinName);
 			// NULL property indicates that this pin was part of the original node, not the 
 			// class we're assigning to:
-			if (!Property)
+			if (!ExposedProperty)
 			{
 				continue;
 			}
+			FProperty* Property = ExposedProperty->Property;
 
 			if (OrgPin->LinkedTo.Num() == 0)
 			{
@@ -75,14 +303,7 @@ UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerConte
 					// We don't want to generate an assignment node unless the default value 
 					// differs from the value in the CDO:
 					FString DefaultValueAsString;
-
-					if (!FBlueprintCompilationManager::GetDefaultValue(ForClass, Property, DefaultValueAsString))
-					{
-						if (ForClass->ClassDefaultObject)
-						{
-							FBlueprintEditorUtils::PropertyValueToString(Property, (uint8*)ForClass->ClassDefaultObject.Get(), DefaultValueAsString);
-						}
-					}
+					FCowExposedPropertyCache::GetDefaultValue(ForClass, *ExposedProperty, DefaultValueAsString);
 
 					// First check the string representation of the default value
 					if (Schema->DoesDefaultValueMatch(*OrgPin, DefaultValueAsString))
@@ -105,12 +326,11 @@ UEdGraphPin* FCowCompilerUtilities::GenerateAssignmentNodes(FKismetCompilerConte
 				}
 			}
 
-			const FString& SetFunctionName = Property->GetMetaData(FBlueprintMetadata::MD_PropertySetFunction);
-			if (!SetFunctionName.IsEmpty())
+			if (!Property->GetMetaData(FBlueprintMetadata::MD_PropertySetFunction).IsEmpty())
 			{
 				UClass* NativeClass = FCowCompilerUtilities::GetFirstNativeClass(const_cast<UClass*>(ForClass)); // Fixed hard-ref to blueprint class
 				
-				UFunction* SetFunction = NativeClass->FindFunctionByName(*SetFunctionName);
+				UFunction* SetFunction = ExposedProperty->SetFunction; // Resolved on NativeClass by the cache
 				check(SetFunction);
 
 				// Add a cast node so we can call the Setter function with a pin of the right class
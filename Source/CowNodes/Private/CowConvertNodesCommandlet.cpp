@@ -0,0 +1,404 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowConvertNodesCommandlet.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#include "Editor/UMGEditor/Private/Nodes/K2Node_CreateWidget.h"
+
+// Cow
+#include "CowBenchmarkUtilities.h"
+#include "CowHardRefUtilities.h"
+#include "K2Node_CowCreateWidgetAsync.h"
+#include "K2Node_CowGetAllActorsOfClass.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowConvertNodes, Log, All);
+
+namespace CowConvertNodes
+{
+	enum class EKind : uint8
+	{
+		CreateWidget,
+		GetAllActorsOfClass,
+		GetActorOfClass,
+		Count
+	};
+
+	const TCHAR* LexToString(EKind Kind)
+	{
+		switch (Kind)
+		{
+			case EKind::CreateWidget:		 return TEXT("CreateWidget");
+			case EKind::GetAllActorsOfClass: return TEXT("GetAllActorsOfClass");
+			default:						 return TEXT("GetActorOfClass");
+		}
+	}
+
+	struct FPackageReport
+	{
+		FName PackageName;
+		int32 Converted[static_cast<int32>(EKind::Count)] = {};
+		int32 Skipped = 0;
+		bool bSaved = false;
+		FCowHardRefUtilities::FClosure Before;
+		FCowHardRefUtilities::FClosure After;
+
+		int32 GetConvertedTotal() const
+		{
+			int32 Total = 0;
+			for (const int32 Count : Converted)
+			{
+				Total += Count;
+			}
+			return Total;
+		}
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Package,CreateWidget,GetAllActorsOfClass,GetActorOfClass,Skipped,Saved,HardPackagesBefore,HardBytesBefore,HardPackagesAfter,HardBytesAfter");
+		}
+
+		FString ToCsvRow() const
+		{
+			return FString::Printf(TEXT("%s,%d,%d,%d,%d,%d,%d,%lld,%d,%lld"),
+				*PackageName.ToString(), Converted[0], Converted[1], Converted[2], Skipped, bSaved ? 1 : 0,
+				Before.Packages, Before.Bytes, After.Packages, After.Bytes);
+		}
+	};
+
+	// Stock node we know how to convert
+	TOptional<EKind> GetKind(const UEdGraphNode* Node)
+	{
+		// Exact class, Cow node is a child of UK2Node_CreateWidget
+		if (Node->GetClass() == UK2Node_CreateWidget::StaticClass())
+		{
+			return EKind::CreateWidget;
+		}
+
+		if (const UK2Node_CallFunction* CallFunction = Cast<UK2Node_CallFunction>(Node))
+		{
+			const UFunction* Function = CallFunction->GetTargetFunction();
+			if (Function && Function->GetOwnerClass() == UGameplayStatics::StaticClass())
+			{
+				if (Function->GetFName() == GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetAllActorsOfClass))
+				{
+					return EKind::GetAllActorsOfClass;
+				}
+				if (Function->GetFName() == GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetActorOfClass))
+				{
+					return EKind::GetActorOfClass;
+				}
+			}
+		}
+		return {};
+	}
+
+	FName GetStockClassPinName(EKind Kind)
+	{
+		return Kind == EKind::CreateWidget ? UK2Node_CowCreateWidgetAsync::WidgetClass : UK2Node_CowGetAllActorsOfClass::ActorClassName;
+	}
+
+	// Cow pin that takes links and value of the stock pin, NAME_None if the stock pin has no counterpart
+	FName GetCowPinName(EKind Kind, const UEdGraphPin* StockPin)
+	{
+		if (StockPin->PinName == GetStockClassPinName(Kind))
+		{
+			// Class is set as soft path
+			return NAME_None;
+		}
+		if (Kind == EKind::CreateWidget && StockPin->PinName == UEdGraphSchema_K2::PN_Then)
+		{
+			// Everything that used the widget after Then has to wait for it now
+			return UK2Node_CowCreateWidgetAsync::WidgetCreated;
+		}
+		if (Kind == EKind::GetActorOfClass && StockPin->PinName == UEdGraphSchema_K2::PN_ReturnValue)
+		{
+			return UK2Node_CowGetAllActorsOfClass::OutActorName;
+		}
+		return StockPin->PinName;
+	}
+
+	// Class selected on the stock node, nullptr if the pin is linked or empty
+	UClass* GetLiteralClass(const UEdGraphNode* StockNode, EKind Kind)
+	{
+		const UEdGraphPin* ClassPin = StockNode->FindPin(GetStockClassPinName(Kind), EGPD_Input);
+		return ClassPin && ClassPin->LinkedTo.IsEmpty() ? Cast<UClass>(ClassPin->DefaultObject) : nullptr;
+	}
+
+	UEdGraphNode* SpawnCowNode(UEdGraph* Graph, EKind Kind, UClass* Class, const UEdGraphNode* StockNode)
+	{
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+		if (Kind == EKind::CreateWidget)
+		{
+			FGraphNodeCreator<UK2Node_CowCreateWidgetAsync> Creator(*Graph);
+			UK2Node_CowCreateWidgetAsync* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+			Node->NodePosX = StockNode->NodePosX;
+			Node->NodePosY = StockNode->NodePosY;
+			Creator.Finalize();
+			// Generates ExposeOnSpawn pins of the class
+			Schema->TrySetDefaultValue(*Node->GetSoftWidgetPin(), Class->GetPathName());
+			return Node;
+		}
+
+		FGraphNodeCreator<UK2Node_CowGetAllActorsOfClass> Creator(*Graph);
+		UK2Node_CowGetAllActorsOfClass* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+		Node->bOutputAsArray = Kind == EKind::GetAllActorsOfClass;
+		Node->NodePosX = StockNode->NodePosX;
+		Node->NodePosY = StockNode->NodePosY;
+		Creator.Finalize();
+		Schema->TrySetDefaultValue(*Node->FindPinChecked(UK2Node_CowGetAllActorsOfClass::ActorClassName, EGPD_Input), Class->GetPathName());
+		return Node;
+	}
+
+	// Why links of the stock node can't be moved to the Cow node, empty if they can
+	FString ValidateConversion(EKind Kind, const UEdGraphNode* StockNode, const UEdGraphNode* CowNode)
+	{
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+		for (const UEdGraphPin* StockPin : StockNode->Pins)
+		{
+			const FName CowPinName = GetCowPinName(Kind, StockPin);
+			if (CowPinName.IsNone() || StockPin->LinkedTo.IsEmpty())
+			{
+				continue;
+			}
+
+			const UEdGraphPin* CowPin = CowNode->FindPin(CowPinName, StockPin->Direction);
+			if (!CowPin)
+			{
+				return FString::Printf(TEXT("linked pin %s doesn't exist on Cow node"), *StockPin->PinName.ToString());
+			}
+
+			// Usually result pin, Cow node returns the first native class
+			for (const UEdGraphPin* LinkedPin : StockPin->LinkedTo)
+			{
+				if (Schema->CanCreateConnection(CowPin, LinkedPin).Response == CONNECT_RESPONSE_DISALLOW)
+				{
+					return FString::Printf(TEXT("%s is used as %s by %s"), *StockPin->PinName.ToString(),
+						*UEdGraphSchema_K2::TypeToText(LinkedPin->PinType).ToString(), *LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString());
+				}
+			}
+		}
+		return FString();
+	}
+
+	void MovePins(EKind Kind, UEdGraphNode* StockNode, UEdGraphNode* CowNode)
+	{
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+		for (UEdGraphPin* StockPin : StockNode->Pins)
+		{
+			const FName CowPinName = GetCowPinName(Kind, StockPin);
+			UEdGraphPin* CowPin = CowPinName.IsNone() ? nullptr : CowNode->FindPin(CowPinName, StockPin->Direction);
+			if (!CowPin)
+			{
+				continue;
+			}
+
+			// ExposeOnSpawn values and other literals
+			if (StockPin->Direction == EGPD_Input && StockPin->LinkedTo.IsEmpty() && !StockPin->DoesDefaultValueMatchAutogenerated())
+			{
+				CowPin->DefaultValue = StockPin->DefaultValue;
+				CowPin->DefaultObject = StockPin->DefaultObject;
+				CowPin->DefaultTextValue = StockPin->DefaultTextValue;
+			}
+			Schema->MovePinLinks(*StockPin, *CowPin);
+		}
+	}
+
+	// Converts all nodes of the Blueprint, returns false if nothing was converted
+	bool ConvertBlueprint(UBlueprint* Blueprint, bool bDryRun, FPackageReport& Report)
+	{
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		for (UEdGraph* Graph : Graphs)
+		{
+			// Nodes are added and removed while we iterate
+			const TArray<TObjectPtr<UEdGraphNode>> Nodes = Graph->Nodes;
+			for (UEdGraphNode* StockNode : Nodes)
+			{
+				const TOptional<EKind> Kind = StockNode ? GetKind(StockNode) : TOptional<EKind>();
+				if (!Kind.IsSet())
+				{
+					continue;
+				}
+
+				auto Skip = [&Report, &Kind, Blueprint](const FString& Reason)
+				{
+					++Report.Skipped;
+					UE_LOG(LogCowConvertNodes, Display, TEXT("  Skipped %s in %s: %s"), LexToString(*Kind), *Blueprint->GetName(), *Reason);
+				};
+
+				UClass* Class = GetLiteralClass(StockNode, *Kind);
+				if (!Class)
+				{
+					Skip(TEXT("class pin is linked or empty"));
+					continue;
+				}
+
+				if (*Kind == EKind::CreateWidget && !GetDefault<UK2Node_CowCreateWidgetAsync>()->IsCompatibleWithGraph(Graph))
+				{
+					Skip(FString::Printf(TEXT("graph %s doesn't support async nodes"), *Graph->GetName()));
+					continue;
+				}
+
+				// Validation needs the Cow node's pins, so dry run spawns it as well and removes it once counted (nothing is saved)
+				UEdGraphNode* CowNode = SpawnCowNode(Graph, *Kind, Class, StockNode);
+				const FString Reason = ValidateConversion(*Kind, StockNode, CowNode);
+				if (!Reason.IsEmpty())
+				{
+					FBlueprintEditorUtils::RemoveNode(Blueprint, CowNode, /*bDontRecompile*/ true);
+					Skip(Reason);
+					continue;
+				}
+
+				if (bDryRun)
+				{
+					FBlueprintEditorUtils::RemoveNode(Blueprint, CowNode, /*bDontRecompile*/ true);
+					++Report.Converted[static_cast<int32>(*Kind)];
+					continue;
+				}
+
+				MovePins(*Kind, StockNode, CowNode);
+				FBlueprintEditorUtils::RemoveNode(Blueprint, StockNode, /*bDontRecompile*/ true);
+				++Report.Converted[static_cast<int32>(*Kind)];
+			}
+		}
+
+		return Report.GetConvertedTotal() > 0;
+	}
+
+	bool CompileAndSave(UBlueprint* Blueprint)
+	{
+		FCompilerResultsLog Results;
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, &Results);
+		if (Blueprint->Status == BS_Error)
+		{
+			UE_LOG(LogCowConvertNodes, Error, TEXT("%s failed to compile after conversion, not saved"), *Blueprint->GetPathName());
+			return false;
+		}
+
+		UPackage* Package = Blueprint->GetOutermost();
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogCowConvertNodes, Error, TEXT("%s is read only (check it out first), not saved"), *Filename);
+			return false;
+		}
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		SaveArgs.Error = GWarn;
+		return UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs);
+	}
+}
+
+UCowConvertNodesCommandlet::UCowConvertNodesCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Replaces CreateWidget, GetAllActorsOfClass and GetActorOfClass nodes with Cow equivalents and reports hard dependency closure before/after");
+	HelpUsage = TEXT("-run=CowConvertNodes [-Paths=/Game] [-DryRun] [-Output=<Path>.csv]");
+}
+
+int32 UCowConvertNodesCommandlet::Main(const FString& Params)
+{
+	using namespace CowConvertNodes;
+
+	const bool bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+	FString PathsValue = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Paths="), PathsValue, /*bShouldStopOnSeparator*/ false);
+
+	TArray<FString> Paths;
+	PathsValue.ParseIntoArray(Paths, TEXT(","));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	// Commandlets don't wait for the background scan
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path.TrimStartAndEnd()));
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+	UE_LOG(LogCowConvertNodes, Display, TEXT("Scanning %d Blueprints under %s%s"), Assets.Num(), *PathsValue, bDryRun ? TEXT(" (dry run)") : TEXT(""));
+
+	TArray<FPackageReport> Reports;
+	TArray<FName> SavedPackages;
+	bool bAnyFailed = false;
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(Assets[AssetIndex].GetAsset());
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		FPackageReport Report;
+		Report.PackageName = Assets[AssetIndex].PackageName;
+		// Before conversion asset registry still has dependencies of the package on disk
+		Report.Before = FCowHardRefUtilities::ComputeHardClosure(Report.PackageName);
+
+		if (ConvertBlueprint(Blueprint, bDryRun, Report) && !bDryRun)
+		{
+			Report.bSaved = CompileAndSave(Blueprint);
+			bAnyFailed |= !Report.bSaved;
+			if (Report.bSaved)
+			{
+				SavedPackages.Add(Report.PackageName);
+			}
+		}
+
+		if (Report.GetConvertedTotal() > 0 || Report.Skipped > 0)
+		{
+			Reports.Add(Report);
+		}
+
+		// Loading every Blueprint of the project at once is exactly what we're trying to avoid
+		if (AssetIndex % 64 == 63)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	// Dependencies of converted packages affect each other, so "after" is computed once everything is saved
+	FCowHardRefUtilities::RescanPackages(SavedPackages);
+
+	TArray<FString> Rows;
+	for (FPackageReport& Report : Reports)
+	{
+		Report.After = Report.bSaved ? FCowHardRefUtilities::ComputeHardClosure(Report.PackageName) : Report.Before;
+
+		UE_LOG(LogCowConvertNodes, Display, TEXT("%-64s Converted=%-3d Skipped=%-3d Hard deps: %d (%.1f MB) -> %d (%.1f MB)"),
+			*Report.PackageName.ToString(), Report.GetConvertedTotal(), Report.Skipped,
+			Report.Before.Packages, Report.Before.Bytes / (1024.0 * 1024.0), Report.After.Packages, Report.After.Bytes / (1024.0 * 1024.0));
+
+		Rows.Add(Report.ToCsvRow());
+	}
+
+	const FString OutputPath = FCowBenchmarkUtilities::GetOutputPath(Params, TEXT("ConvertNodes.csv"));
+	const bool bWritten = FCowBenchmarkUtilities::WriteCsv(OutputPath, FPackageReport::GetCsvHeader(), Rows);
+	return bWritten && !bAnyFailed ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowExposedPropertyCache.h"
+
+// Engine
+#include "BlueprintCompilationManager.h"
+#include "EdGraphSchema_K2.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+// Cow
+#include "CowCompilerUtilities.h"
+
+namespace
+{
+	TUniquePtr<FCowExposedPropertyCache> GCowExposedPropertyCache;
+}
+
+const FCowExposedProperty* FCowClassExposedProperties::Find(FName PropertyName) const
+{
+	const int32* Index = NameToIndex.Find(PropertyName);
+	return Index ? &Properties[*Index] : nullptr;
+}
+
+FCowExposedPropertyCache& FCowExposedPropertyCache::Get()
+{
+	if (!GCowExposedPropertyCache)
+	{
+		GCowExposedPropertyCache.Reset(new FCowExposedPropertyCache());
+	}
+	return *GCowExposedPropertyCache;
+}
+
+void FCowExposedPropertyCache::Shutdown()
+{
+	GCowExposedPropertyCache.Reset();
+}
+
+FCowExposedPropertyCache::FCowExposedPropertyCache()
+{
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FCowExposedPropertyCache::OnObjectsReplaced);
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FCowExposedPropertyCache::OnObjectPropertyChanged);
+	OnReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		InvalidateAll();
+	});
+
+	if (GEditor)
+	{
+		BindEditorDelegates();
+	}
+	else
+	{
+		OnPostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FCowExposedPropertyCache::BindEditorDelegates);
+	}
+}
+
+FCowExposedPropertyCache::~FCowExposedPropertyCache()
+{
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(OnReloadCompleteHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(OnPostEngineInitHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(OnBlueprintPreCompileHandle);
+	}
+}
+
+void FCowExposedPropertyCache::BindEditorDelegates()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(OnPostEngineInitHandle);
+	OnPostEngineInitHandle.Reset();
+
+	if (GEditor && !OnBlueprintPreCompileHandle.IsValid())
+	{
+		OnBlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FCowExposedPropertyCache::OnBlueprintPreCompile);
+	}
+}
+
+TSharedRef<const FCowClassExposedProperties> FCowExposedPropertyCache::GetClassProperties(const UClass* Class)
+{
+	check(Class);
+
+	// Layout of a class being compiled can still change under our feet, don't remember anything about it
+	if (IsClassBeingCompiled(Class))
+	{
+		return BuildClassProperties(Class);
+	}
+
+	const TObjectKey<UClass> ClassKey(Class);
+	if (const TSharedRef<FCowClassExposedProperties>* Cached = Cache.Find(ClassKey))
+	{
+		const bool bSameCDO = (*Cached)->ClassDefaultObject.Get() == Class->GetDefaultObject(false);
+		const bool bSameLayout = (*Cached)->PropertyLink == Class->PropertyLink;
+		if (bSameCDO && bSameLayout)
+		{
+			return *Cached;
+		}
+	}
+
+	return Cache.Add(ClassKey, BuildClassProperties(Class));
+}
+
+bool FCowExposedPropertyCache::GetDefaultValue(const UClass* Class, const FCowExposedProperty& ExposedProperty, FString& OutDefaultValueAsString)
+{
+	// Compilation manager knows better while the class is being compiled (CDO may not exist yet)
+	if (FBlueprintCompilationManager::GetDefaultValue(Class, ExposedProperty.Property, OutDefaultValueAsString))
+	{
+		return true;
+	}
+
+	if (ExposedProperty.bHasCDODefaultValue)
+	{
+		OutDefaultValueAsString = ExposedProperty.CDODefaultValue;
+		return true;
+	}
+	return false;
+}
+
+void FCowExposedPropertyCache::Invalidate(const UClass* Class)
+{
+	Cache.Remove(TObjectKey<UClass>(Class));
+}
+
+void FCowExposedPropertyCache::InvalidateWithChildren(const UClass* Class)
+{
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		// Entries of collected classes go as well
+		const UClass* CachedClass = It.Key().ResolveObjectPtr();
+		if (!CachedClass || CachedClass->IsChildOf(Class))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FCowExposedPropertyCache::InvalidateAll()
+{
+	Cache.Reset();
+}
+
+bool FCowExposedPropertyCache::IsClassBeingCompiled(const UClass* Class)
+{
+	// Layout change of any Blueprint parent changes our layout as well
+	for (const UClass* It = Class; It && !It->HasAnyClassFlags(CLASS_Native); It = It->GetSuperClass())
+	{
+		const UBlueprint* Blueprint = Cast<UBlueprint>(It->ClassGeneratedBy);
+		if (Blueprint && Blueprint->bBeingCompiled)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TSharedRef<FCowClassExposedProperties> FCowExposedPropertyCache::BuildClassProperties(const UClass* Class)
+{
+	TSharedRef<FCowClassExposedProperties> Result = MakeShared<FCowClassExposedProperties>();
+
+	const UObject* CDO = Class->GetDefaultObject(false);
+	Result->ClassDefaultObject = const_cast<UObject*>(CDO);
+	Result->PropertyLink = Class->PropertyLink;
+
+	const UClass* NativeClass = FCowCompilerUtilities::GetFirstNativeClass(Class);
+
+	for (TFieldIterator<FProperty> PropertyIt(Class, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+		if (!FCowCompilerUtilities::IsExposedOnSpawnProperty(Property))
+		{
+			continue;
+		}
+
+		FCowExposedProperty& Exposed = Result->Properties.AddDefaulted_GetRef();
+		Exposed.Property = Property;
+
+		const FString& SetFunctionName = Property->GetMetaData(FBlueprintMetadata::MD_PropertySetFunction);
+		if (!SetFunctionName.IsEmpty() && NativeClass)
+		{
+			Exposed.SetFunction = NativeClass->FindFunctionByName(*SetFunctionName);
+		}
+
+		if (CDO)
+		{
+			Exposed.bHasCDODefaultValue = FBlueprintEditorUtils::PropertyValueToString(Property, reinterpret_cast<const uint8*>(CDO), Exposed.CDODefaultValue);
+		}
+
+		Result->NameToIndex.Add(Property->GetFName(), Result->Properties.Num() - 1);
+	}
+
+	return Result;
+}
+
+void FCowExposedPropertyCache::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	if (Cache.IsEmpty())
+	{
+		return;
+	}
+
+	for (const TPair<UObject*, UObject*>& Pair : ReplacementMap)
+	{
+		const UObject* OldObject = Pair.Key;
+		if (!OldObject)
+		{
+			continue;
+		}
+
+		if (const UClass* OldClass = Cast<UClass>(OldObject))
+		{
+			Invalidate(OldClass);
+		}
+		else if (OldObject->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			Invalidate(OldObject->GetClass());
+		}
+	}
+}
+
+void FCowExposedPropertyCache::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Cached default strings come from CDOs only, instances are of no interest
+	if (Object && Object->HasAnyFlags(RF_ClassDefaultObject) && !Cache.IsEmpty())
+	{
+		InvalidateWithChildren(Object->GetClass());
+	}
+}
+
+void FCowExposedPropertyCache::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	if (Blueprint && Blueprint->GeneratedClass && !Cache.IsEmpty())
+	{
+		InvalidateWithChildren(Blueprint->GeneratedClass);
+	}
+}
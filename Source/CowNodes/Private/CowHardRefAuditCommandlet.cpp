@@ -0,0 +1,459 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowHardRefAuditCommandlet.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Variable.h"
+#include "Misc/FileHelper.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+// Cow
+#include "CowBenchmarkUtilities.h"
+#include "CowCompilerUtilities.h"
+#include "CowHardRefUtilities.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowHardRefAudit, Log, All);
+
+namespace CowHardRefAudit
+{
+	// Bump when the meaning of existing fields changes, baseline with another version is refused
+	constexpr int32 ReportVersion = 1;
+
+	const TCHAR* UnattributedSource = TEXT("Unattributed");
+
+	struct FNodeEntry
+	{
+		FString Graph;
+		FString Node;
+		FString Guid;
+		// Cow node name for replaceable nodes, class path for hard-ref notes
+		FString Detail;
+		// Pin name for hard-ref notes
+		FString Pin;
+
+		bool operator<(const FNodeEntry& Other) const
+		{
+			return Graph != Other.Graph ? Graph < Other.Graph : Guid < Other.Guid;
+		}
+	};
+
+	struct FAssetReport
+	{
+		FName PackageName;
+		bool bMap = false;
+		FCowHardRefUtilities::FClosure Closure;
+		// Direct hard dependency -> what created it
+		TMap<FName, TSet<FString>> Edges;
+		TArray<FNodeEntry> ReplaceableNodes;
+		TArray<FNodeEntry> HardRefNotes;
+	};
+
+	struct FBaselineEntry
+	{
+		int32 HardPackages = 0;
+		int64 HardBytes = 0;
+		int32 ReplaceableNodes = 0;
+		int32 HardRefNotes = 0;
+	};
+
+	FString DescribeNode(const UEdGraphNode* Node)
+	{
+		return FString::Printf(TEXT("%s: %s {%s}"), *Node->GetGraph()->GetName(), *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Node->NodeGuid.ToString());
+	}
+
+	FNodeEntry MakeNodeEntry(const UEdGraphNode* Node, const FString& Detail, const FString& Pin = FString())
+	{
+		return FNodeEntry{ Node->GetGraph()->GetName(), Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), Node->NodeGuid.ToString(), Detail, Pin };
+	}
+
+	// Objects the node references in a way that ends up in the package imports
+	void CollectNodeObjects(const UEdGraphNode* Node, TArray<const UObject*>& OutObjects)
+	{
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			OutObjects.Add(Pin->PinType.PinSubCategoryObject.Get());
+			OutObjects.Add(Pin->PinType.PinValueType.TerminalSubCategoryObject.Get());
+			OutObjects.Add(Pin->DefaultObject);
+		}
+
+		if (const UK2Node_CallFunction* CallFunction = Cast<UK2Node_CallFunction>(Node))
+		{
+			OutObjects.Add(CallFunction->FunctionReference.GetMemberParentClass(CallFunction->GetBlueprintClassFromNode()));
+		}
+		else if (const UK2Node_Variable* Variable = Cast<UK2Node_Variable>(Node))
+		{
+			OutObjects.Add(Variable->VariableReference.GetMemberParentClass(Variable->GetBlueprintClassFromNode()));
+		}
+		else if (const UK2Node_MacroInstance* MacroInstance = Cast<UK2Node_MacroInstance>(Node))
+		{
+			OutObjects.Add(MacroInstance->GetMacroGraph());
+		}
+	}
+
+	// Adds Source to every edge that goes to a package of Objects, objects outside of direct hard dependencies are ignored
+	// (script packages, the asset itself, soft references)
+	void AttributeObjects(FAssetReport& Report, TConstArrayView<const UObject*> Objects, const FString& Source)
+	{
+		for (const UObject* Object : Objects)
+		{
+			if (!Object)
+			{
+				continue;
+			}
+			if (TSet<FString>* Sources = Report.Edges.Find(Object->GetPackage()->GetFName()))
+			{
+				Sources->Add(Source);
+			}
+		}
+	}
+
+	void AuditBlueprint(const UBlueprint* Blueprint, FAssetReport& Report)
+	{
+		AttributeObjects(Report, { Blueprint->ParentClass.Get() }, TEXT("Parent class"));
+
+		for (const FBPInterfaceDescription& Interface : Blueprint->ImplementedInterfaces)
+		{
+			AttributeObjects(Report, { Interface.Interface.Get() }, TEXT("Interface"));
+		}
+
+		for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+		{
+			AttributeObjects(Report, { Variable.VarType.PinSubCategoryObject.Get(), Variable.VarType.PinValueType.TerminalSubCategoryObject.Get() },
+				FString::Printf(TEXT("Variable %s"), *Variable.VarName.ToString()));
+		}
+
+		if (Blueprint->SimpleConstructionScript)
+		{
+			for (const USCS_Node* ComponentNode : Blueprint->SimpleConstructionScript->GetAllNodes())
+			{
+				AttributeObjects(Report, { ComponentNode->ComponentClass }, FString::Printf(TEXT("Component %s"), *ComponentNode->GetVariableName().ToString()));
+			}
+		}
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+		TArray<const UObject*> NodeObjects;
+		for (const UEdGraph* Graph : Graphs)
+		{
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+				{
+					continue;
+				}
+
+				NodeObjects.Reset();
+				CollectNodeObjects(Node, NodeObjects);
+				AttributeObjects(Report, NodeObjects, DescribeNode(Node));
+
+				if (const TCHAR* Replacement = FCowHardRefUtilities::GetCowReplacement(Node))
+				{
+					Report.ReplaceableNodes.Add(MakeNodeEntry(Node, Replacement));
+				}
+
+				for (const UEdGraphPin* Pin : Node->Pins)
+				{
+					if (Pin->Direction != EGPD_Input || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_SoftClass)
+					{
+						continue;
+					}
+					if (const UClass* Class = FCowCompilerUtilities::GetHardRefThroughSoftClassPin(Pin))
+					{
+						Report.HardRefNotes.Add(MakeNodeEntry(Node, Class->GetPathName(), Pin->PinName.ToString()));
+					}
+				}
+			}
+		}
+
+		Report.ReplaceableNodes.Sort();
+		Report.HardRefNotes.Sort();
+	}
+
+	TSharedRef<FJsonObject> NodeEntryToJson(const FNodeEntry& Entry, const TCHAR* DetailField)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("graph"), Entry.Graph);
+		Object->SetStringField(TEXT("node"), Entry.Node);
+		Object->SetStringField(TEXT("guid"), Entry.Guid);
+		if (!Entry.Pin.IsEmpty())
+		{
+			Object->SetStringField(TEXT("pin"), Entry.Pin);
+		}
+		Object->SetStringField(DetailField, Entry.Detail);
+		return Object;
+	}
+
+	TSharedRef<FJsonObject> ReportToJson(const FAssetReport& Report, TMap<FName, FCowHardRefUtilities::FClosure>& DependencyClosures)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("package"), Report.PackageName.ToString());
+		Object->SetStringField(TEXT("type"), Report.bMap ? TEXT("Map") : TEXT("Blueprint"));
+		Object->SetNumberField(TEXT("hardPackages"), Report.Closure.Packages);
+		Object->SetNumberField(TEXT("hardBytes"), static_cast<double>(Report.Closure.Bytes));
+
+		TArray<FName> Dependencies;
+		Report.Edges.GetKeys(Dependencies);
+		Dependencies.Sort(FNameLexicalLess());
+
+		TArray<TSharedPtr<FJsonValue>> Edges;
+		for (const FName Dependency : Dependencies)
+		{
+			// Edges of different assets often go to the same packages
+			const FCowHardRefUtilities::FClosure* Closure = DependencyClosures.Find(Dependency);
+			if (!Closure)
+			{
+				Closure = &DependencyClosures.Add(Dependency, FCowHardRefUtilities::ComputeHardClosure(Dependency));
+			}
+
+			TArray<FString> Sources = Report.Edges[Dependency].Array();
+			Sources.Sort();
+			if (Sources.IsEmpty())
+			{
+				Sources.Add(UnattributedSource);
+			}
+
+			TArray<TSharedPtr<FJsonValue>> SourceValues;
+			for (const FString& Source : Sources)
+			{
+				SourceValues.Add(MakeShared<FJsonValueString>(Source));
+			}
+
+			// Closure of the edge includes the dependency itself, that's what removing the only edge to it would save at most
+			TSharedRef<FJsonObject> Edge = MakeShared<FJsonObject>();
+			Edge->SetStringField(TEXT("package"), Dependency.ToString());
+			Edge->SetNumberField(TEXT("bytes"), static_cast<double>(FCowHardRefUtilities::GetPackageDiskSize(Dependency)));
+			Edge->SetNumberField(TEXT("closurePackages"), Closure->Packages + 1);
+			Edge->SetNumberField(TEXT("closureBytes"), static_cast<double>(Closure->Bytes + FCowHardRefUtilities::GetPackageDiskSize(Dependency)));
+			Edge->SetArrayField(TEXT("sources"), SourceValues);
+			Edges.Add(MakeShared<FJsonValueObject>(Edge));
+		}
+		Object->SetArrayField(TEXT("edges"), Edges);
+
+		TArray<TSharedPtr<FJsonValue>> ReplaceableNodes;
+		for (const FNodeEntry& Entry : Report.ReplaceableNodes)
+		{
+			ReplaceableNodes.Add(MakeShared<FJsonValueObject>(NodeEntryToJson(Entry, TEXT("replacement"))));
+		}
+		Object->SetArrayField(TEXT("replaceableNodes"), ReplaceableNodes);
+
+		TArray<TSharedPtr<FJsonValue>> HardRefNotes;
+		for (const FNodeEntry& Entry : Report.HardRefNotes)
+		{
+			HardRefNotes.Add(MakeShared<FJsonValueObject>(NodeEntryToJson(Entry, TEXT("class"))));
+		}
+		Object->SetArrayField(TEXT("hardRefNotes"), HardRefNotes);
+		return Object;
+	}
+
+	bool LoadBaseline(const FString& Path, TMap<FName, FBaselineEntry>& OutEntries)
+	{
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *Path))
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("Failed to read baseline %s"), *Path);
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Content), Root) || !Root.IsValid())
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("Baseline %s isn't valid JSON"), *Path);
+			return false;
+		}
+
+		int32 Version = 0;
+		if (!Root->TryGetNumberField(TEXT("version"), Version) || Version != ReportVersion)
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("Baseline %s has version %d, expected %d. Regenerate it"), *Path, Version, ReportVersion);
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Assets = nullptr;
+		if (!Root->TryGetArrayField(TEXT("assets"), Assets))
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("Baseline %s has no assets"), *Path);
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *Assets)
+		{
+			const TSharedPtr<FJsonObject> Asset = Value->AsObject();
+			FString PackageName;
+			if (!Asset.IsValid() || !Asset->TryGetStringField(TEXT("package"), PackageName))
+			{
+				continue;
+			}
+
+			FBaselineEntry& Entry = OutEntries.Add(FName(*PackageName));
+			Asset->TryGetNumberField(TEXT("hardPackages"), Entry.HardPackages);
+			Asset->TryGetNumberField(TEXT("hardBytes"), Entry.HardBytes);
+			const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+			Entry.ReplaceableNodes = Asset->TryGetArrayField(TEXT("replaceableNodes"), Array) ? Array->Num() : 0;
+			Entry.HardRefNotes = Asset->TryGetArrayField(TEXT("hardRefNotes"), Array) ? Array->Num() : 0;
+		}
+		return true;
+	}
+
+	// Logs every regression of Report against the baseline, returns true if there is any
+	bool CheckRegression(const FAssetReport& Report, const FBaselineEntry& Baseline, double Tolerance)
+	{
+		const FString Package = Report.PackageName.ToString();
+		bool bRegressed = false;
+		if (Report.Closure.Bytes > Baseline.HardBytes * (1.0 + Tolerance) || Report.Closure.Packages > Baseline.HardPackages * (1.0 + Tolerance))
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("%s: hard closure grew from %d packages (%.1f MB) to %d packages (%.1f MB)"), *Package,
+				Baseline.HardPackages, Baseline.HardBytes / (1024.0 * 1024.0), Report.Closure.Packages, Report.Closure.Bytes / (1024.0 * 1024.0));
+			bRegressed = true;
+		}
+		if (Report.ReplaceableNodes.Num() > Baseline.ReplaceableNodes)
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("%s: stock nodes replaceable with Cow ones went from %d to %d"), *Package, Baseline.ReplaceableNodes, Report.ReplaceableNodes.Num());
+			bRegressed = true;
+		}
+		if (Report.HardRefNotes.Num() > Baseline.HardRefNotes)
+		{
+			UE_LOG(LogCowHardRefAudit, Error, TEXT("%s: hard-refs through soft class pins went from %d to %d"), *Package, Baseline.HardRefNotes, Report.HardRefNotes.Num());
+			bRegressed = true;
+		}
+		return bRegressed;
+	}
+}
+
+UCowHardRefAuditCommandlet::UCowHardRefAuditCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Writes hard reference closure of every Blueprint and map with node attribution as JSON, optionally fails on regressions against a baseline");
+	HelpUsage = TEXT("-run=CowHardRefAudit [-Paths=/Game] [-Output=<Path>.json] [-Baseline=<Path>.json] [-Tolerance=<Percent>]");
+}
+
+int32 UCowHardRefAuditCommandlet::Main(const FString& Params)
+{
+	using namespace CowHardRefAudit;
+
+	FString PathsValue = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Paths="), PathsValue, /*bShouldStopOnSeparator*/ false);
+
+	TArray<FString> Paths;
+	PathsValue.ParseIntoArray(Paths, TEXT(","));
+
+	FString BaselinePath;
+	const bool bHasBaseline = FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	double TolerancePercent = 0.0;
+	FParse::Value(*Params, TEXT("Tolerance="), TolerancePercent);
+
+	TMap<FName, FBaselineEntry> Baseline;
+	if (bHasBaseline && !LoadBaseline(FPaths::ConvertRelativePathToFull(BaselinePath), Baseline))
+	{
+		return 1;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	// Commandlets don't wait for the background scan
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path.TrimStartAndEnd()));
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+	Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+	UE_LOG(LogCowHardRefAudit, Display, TEXT("Auditing %d Blueprints and maps under %s"), Assets.Num(), *PathsValue);
+
+	TArray<FAssetReport> Reports;
+	Reports.Reserve(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FAssetData& AssetData = Assets[AssetIndex];
+
+		FAssetReport& Report = Reports.AddDefaulted_GetRef();
+		Report.PackageName = AssetData.PackageName;
+		Report.bMap = AssetData.AssetClassPath == UWorld::StaticClass()->GetClassPathName();
+		Report.Closure = FCowHardRefUtilities::ComputeHardClosure(Report.PackageName);
+		for (const FName Dependency : FCowHardRefUtilities::GetDirectHardDependencies(Report.PackageName))
+		{
+			Report.Edges.Add(Dependency);
+		}
+
+		// Loading a map would load its whole closure, which is exactly what we're measuring
+		if (!Report.bMap)
+		{
+			if (const UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+			{
+				AuditBlueprint(Blueprint, Report);
+			}
+		}
+
+		// Loading every Blueprint of the project at once is exactly what we're trying to avoid
+		if (AssetIndex % 64 == 63)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	const double Tolerance = TolerancePercent / 100.0;
+	TMap<FName, FCowHardRefUtilities::FClosure> DependencyClosures;
+	TArray<TSharedPtr<FJsonValue>> AssetValues;
+	int32 ReplaceableNodes = 0;
+	int32 HardRefNotes = 0;
+	int32 Regressions = 0;
+	for (const FAssetReport& Report : Reports)
+	{
+		AssetValues.Add(MakeShared<FJsonValueObject>(ReportToJson(Report, DependencyClosures)));
+		ReplaceableNodes += Report.ReplaceableNodes.Num();
+		HardRefNotes += Report.HardRefNotes.Num();
+
+		if (const FBaselineEntry* BaselineEntry = Baseline.Find(Report.PackageName))
+		{
+			Regressions += CheckRegression(Report, *BaselineEntry, Tolerance) ? 1 : 0;
+		}
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("version"), ReportVersion);
+	Root->SetArrayField(TEXT("assets"), AssetValues);
+
+	FString Content;
+	FJsonSerializer::Serialize(Root, TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Content));
+
+	const FString OutputPath = FCowBenchmarkUtilities::GetOutputPath(Params, TEXT("HardRefAudit.json"));
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), /*Tree*/ true);
+	const bool bWritten = FFileHelper::SaveStringToFile(Content, *OutputPath);
+	if (bWritten)
+	{
+		UE_LOG(LogCowHardRefAudit, Display, TEXT("Report (%d assets, %d replaceable nodes, %d hard-ref notes) written to %s"), Reports.Num(), ReplaceableNodes, HardRefNotes, *OutputPath);
+	}
+	else
+	{
+		UE_LOG(LogCowHardRefAudit, Error, TEXT("Failed to write %s"), *OutputPath);
+	}
+
+	if (Regressions > 0)
+	{
+		UE_LOG(LogCowHardRefAudit, Error, TEXT("%d assets regressed against %s"), Regressions, *BaselinePath);
+	}
+	return bWritten && Regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowHardRefUtilities.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_GenericCreateObject.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Editor/UMGEditor/Private/Nodes/K2Node_CreateWidget.h"
+
+namespace
+{
+	IAssetRegistry& GetAssetRegistry()
+	{
+		return FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	}
+
+	bool HasBlueprintClassSelected(const UEdGraphNode* Node, FName ClassPinName)
+	{
+		const UEdGraphPin* ClassPin = Node->FindPin(ClassPinName, EGPD_Input);
+		const UClass* Class = ClassPin && ClassPin->LinkedTo.IsEmpty() ? Cast<UClass>(ClassPin->DefaultObject) : nullptr;
+		return Class && !Class->HasAnyClassFlags(CLASS_Native);
+	}
+}
+
+FCowHardRefUtilities::FClosure FCowHardRefUtilities::ComputeHardClosure(FName PackageName, TSet<FName>* OutPackages)
+{
+	TSet<FName> Visited;
+	TArray<FName> Stack = GetDirectHardDependencies(PackageName);
+	Visited.Add(PackageName);
+
+	FClosure Closure;
+	while (!Stack.IsEmpty())
+	{
+		const FName Dependency = Stack.Pop(EAllowShrinking::No);
+		bool bAlreadyVisited = false;
+		Visited.Add(Dependency, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			continue;
+		}
+
+		++Closure.Packages;
+		Closure.Bytes += GetPackageDiskSize(Dependency);
+		if (OutPackages)
+		{
+			OutPackages->Add(Dependency);
+		}
+		Stack.Append(GetDirectHardDependencies(Dependency));
+	}
+	return Closure;
+}
+
+TArray<FName> FCowHardRefUtilities::GetDirectHardDependencies(FName PackageName)
+{
+	TArray<FAssetIdentifier> Dependencies;
+	GetAssetRegistry().GetDependencies(FAssetIdentifier(PackageName), Dependencies,
+		UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+	TArray<FName> PackageNames;
+	PackageNames.Reserve(Dependencies.Num());
+	for (const FAssetIdentifier& Dependency : Dependencies)
+	{
+		if (!Dependency.PackageName.IsNone() && !FPackageName::IsScriptPackage(Dependency.PackageName.ToString()))
+		{
+			PackageNames.Add(Dependency.PackageName);
+		}
+	}
+	return PackageNames;
+}
+
+int64 FCowHardRefUtilities::GetPackageDiskSize(FName PackageName)
+{
+	const TOptional<FAssetPackageData> PackageData = GetAssetRegistry().GetAssetPackageDataCopy(PackageName);
+	return PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+}
+
+const TCHAR* FCowHardRefUtilities::GetCowReplacement(const UEdGraphNode* Node)
+{
+	// Exact classes, Cow nodes are children of the stock ones
+	const UClass* NodeClass = Node->GetClass();
+	if (NodeClass == UK2Node_CreateWidget::StaticClass())
+	{
+		return HasBlueprintClassSelected(Node, TEXT("Class")) ? TEXT("CowCreateWidgetAsync") : nullptr;
+	}
+	if (NodeClass == UK2Node_SpawnActorFromClass::StaticClass())
+	{
+		return HasBlueprintClassSelected(Node, TEXT("Class")) ? TEXT("CowSpawnActorAsync") : nullptr;
+	}
+	if (NodeClass == UK2Node_GenericCreateObject::StaticClass())
+	{
+		return HasBlueprintClassSelected(Node, TEXT("Class")) ? TEXT("CowConstructObjectAsync") : nullptr;
+	}
+
+	const UK2Node_CallFunction* CallFunction = Cast<UK2Node_CallFunction>(Node);
+	const UFunction* Function = CallFunction ? CallFunction->GetTargetFunction() : nullptr;
+	if (!Function)
+	{
+		return nullptr;
+	}
+
+	const FName FunctionName = Function->GetFName();
+	const UClass* FunctionOwner = Function->GetOwnerClass();
+	if (FunctionOwner == UGameplayStatics::StaticClass()
+		&& (FunctionName == GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetAllActorsOfClass) || FunctionName == GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetActorOfClass)))
+	{
+		return HasBlueprintClassSelected(Node, TEXT("ActorClass")) ? TEXT("CowGetAllActorsOfClass") : nullptr;
+	}
+	if (FunctionOwner == UWidgetBlueprintLibrary::StaticClass() && FunctionName == GET_FUNCTION_NAME_CHECKED(UWidgetBlueprintLibrary, GetAllWidgetsOfClass))
+	{
+		return HasBlueprintClassSelected(Node, TEXT("WidgetClass")) ? TEXT("CowGetAllWidgetsOfClass") : nullptr;
+	}
+	if (FunctionOwner == UKismetMathLibrary::StaticClass() && FunctionName == GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, ClassIsChildOf))
+	{
+		return HasBlueprintClassSelected(Node, TEXT("TestClass")) || HasBlueprintClassSelected(Node, TEXT("ParentClass")) ? TEXT("CowSoftClassIsChildOf") : nullptr;
+	}
+	return nullptr;
+}
+
+void FCowHardRefUtilities::RescanPackages(const TArray<FName>& PackageNames)
+{
+	TArray<FString> Filenames;
+	for (const FName PackageName : PackageNames)
+	{
+		FString Filename;
+		if (FPackageName::DoesPackageExist(PackageName.ToString(), &Filename))
+		{
+			Filenames.Add(FPaths::ConvertRelativePathToFull(Filename));
+		}
+	}
+	GetAssetRegistry().ScanFilesSynchronous(Filenames, /*bForceRescan*/ true);
+}
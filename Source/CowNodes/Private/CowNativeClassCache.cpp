@@ -0,0 +1,143 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowNativeClassCache.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/BlueprintSupport.h"
+
+namespace
+{
+	TUniquePtr<FCowNativeClassCache> GCowNativeClassCache;
+}
+
+FCowNativeClassCache& FCowNativeClassCache::Get()
+{
+	if (!GCowNativeClassCache)
+	{
+		GCowNativeClassCache.Reset(new FCowNativeClassCache());
+	}
+	return *GCowNativeClassCache;
+}
+
+void FCowNativeClassCache::Shutdown()
+{
+	GCowNativeClassCache.Reset();
+}
+
+FCowNativeClassCache::FCowNativeClassCache()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FCowNativeClassCache::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FCowNativeClassCache::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FCowNativeClassCache::OnAssetRenamed);
+	OnAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FCowNativeClassCache::OnAssetUpdated);
+	OnFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FCowNativeClassCache::InvalidateAll);
+}
+
+FCowNativeClassCache::~FCowNativeClassCache()
+{
+	// Asset registry could be already unloaded on editor shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(OnFilesLoadedHandle);
+	}
+}
+
+UClass* FCowNativeClassCache::FindNativeClass(const FSoftObjectPath& SoftClassPath)
+{
+	if (SoftClassPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const TWeakObjectPtr<UClass>* Cached = Cache.Find(SoftClassPath))
+	{
+		if (UClass* CachedClass = Cached->Get())
+		{
+			return CachedClass;
+		}
+	}
+
+	UClass* NativeClass = ResolveNativeClass(SoftClassPath);
+	if (NativeClass)
+	{
+		Cache.Add(SoftClassPath, NativeClass);
+		PackageToPaths.AddUnique(SoftClassPath.GetLongPackageFName(), SoftClassPath);
+	}
+	return NativeClass;
+}
+
+void FCowNativeClassCache::InvalidateAll()
+{
+	Cache.Reset();
+	PackageToPaths.Reset();
+}
+
+UClass* FCowNativeClassCache::ResolveNativeClass(const FSoftObjectPath& SoftClassPath)
+{
+	// If class is blueprint try to get native parent from metadata to avoid loading class here
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	FAssetData AssetData;
+	if (AssetRegistryModule.Get().TryGetAssetByObjectPath(SoftClassPath, AssetData) == UE::AssetRegistry::EExists::Exists)
+	{
+		UClass* NativeParentClass = nullptr;
+		FString ParentClassName;
+		if(!AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassName))
+		{
+			// By the looks of it we shouldn't rely on it but all places that use NativeParentClassPath do, so let's be safe
+			AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassName);
+		}
+		if(!ParentClassName.IsEmpty())
+		{
+			UObject* Outer = nullptr;
+			ResolveName(Outer, ParentClassName, false, false);
+			NativeParentClass = FindObject<UClass>(Outer, *ParentClassName);
+		}
+		return NativeParentClass;
+	}
+
+	return FindObject<UClass>(SoftClassPath.GetAssetPath(), true);
+}
+
+void FCowNativeClassCache::InvalidatePackage(FName PackageName)
+{
+	if (Cache.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath, TInlineAllocator<2>> Paths;
+	PackageToPaths.MultiFind(PackageName, Paths);
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		Cache.Remove(Path);
+	}
+	PackageToPaths.Remove(PackageName);
+}
+
+void FCowNativeClassCache::OnAssetAdded(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+}
+
+void FCowNativeClassCache::OnAssetRemoved(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+}
+
+void FCowNativeClassCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	InvalidatePackage(AssetData.PackageName);
+	InvalidatePackage(FSoftObjectPath(OldObjectPath).GetLongPackageFName());
+}
+
+void FCowNativeClassCache::OnAssetUpdated(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+}
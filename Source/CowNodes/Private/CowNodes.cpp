@@ -3,6 +3,9 @@
 #include "Modules/ModuleManager.h"
 #include "ToolMenus.h"
 #include "K2Node_CallFunction.h"
+#include "CowExposedPropertyCache.h"
+#include "CowNativeClassCache.h"
+#include "CowSoftReferenceCollector.h"
 
 class FCowNodesModule : public IModuleInterface
 {
@@ -10,10 +13,14 @@ public:
 	virtual void StartupModule() override
 	{
 		UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FCowNodesModule::RegisterMenuExtensions));
+		FCowSoftReferenceCollector::Register();
 	}
 
 	virtual void ShutdownModule() override
 	{
+		FCowSoftReferenceCollector::Unregister();
+		FCowExposedPropertyCache::Shutdown();
+		FCowNativeClassCache::Shutdown();
 	}
 
 	static void CreateActionNodeSection(UToolMenu* NodeMenu)
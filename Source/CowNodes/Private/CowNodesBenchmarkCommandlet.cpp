@@ -0,0 +1,332 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowNodesBenchmarkCommandlet.h"
+
+// Engine
+#include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "WidgetBlueprint.h"
+#include "Editor/UMGEditor/Private/Nodes/K2Node_CreateWidget.h"
+
+// Cow
+#include "CowBenchmarkUtilities.h"
+#include "CowCompilerUtilities.h"
+#include "CowNodesSettings.h"
+#include "K2Node_CowCreateWidgetAsync.h"
+#include "K2Node_CowGetAllActorsOfClass.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowNodesBenchmark, Log, All);
+
+namespace CowNodesBenchmark
+{
+	enum class ENodeKind : uint8
+	{
+		CreateWidget,
+		GetAllActorsOfClass
+	};
+
+	enum class EVariant : uint8
+	{
+		CowCompact,
+		CowLegacy,
+		Stock
+	};
+
+	const TCHAR* LexToString(ENodeKind Kind)
+	{
+		return Kind == ENodeKind::CreateWidget ? TEXT("CreateWidget") : TEXT("GetAllActorsOfClass");
+	}
+
+	const TCHAR* LexToString(EVariant Variant)
+	{
+		switch (Variant)
+		{
+			case EVariant::CowCompact: return TEXT("CowCompact");
+			case EVariant::CowLegacy:  return TEXT("CowLegacy");
+			default:				   return TEXT("Stock");
+		}
+	}
+
+	UWidgetBlueprint* CreateWidgetBlueprint(int32 ExposedCount)
+	{
+		const FString AssetName = FString::Printf(TEXT("WBP_CowBenchmark_%d"), ExposedCount);
+		UWidgetBlueprint* Blueprint = CastChecked<UWidgetBlueprint>(FCowBenchmarkUtilities::CreateTransientBlueprint(
+			UUserWidget::StaticClass(), AssetName, UWidgetBlueprint::StaticClass(), UWidgetBlueprintGeneratedClass::StaticClass()));
+
+		// Mix of types so assignments go through different paths (and literal conversions)
+		static const FName Categories[] = { UEdGraphSchema_K2::PC_Int, UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_String, UEdGraphSchema_K2::PC_Boolean };
+		for (int32 Index = 0; Index < ExposedCount; ++Index)
+		{
+			FEdGraphPinType PinType;
+			PinType.PinCategory = Categories[Index % UE_ARRAY_COUNT(Categories)];
+			if (PinType.PinCategory == UEdGraphSchema_K2::PC_Real)
+			{
+				PinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
+			}
+
+			const FName VarName(*FString::Printf(TEXT("Exposed_%d"), Index));
+			FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, PinType);
+			FBlueprintEditorUtils::SetBlueprintOnlyEditableFlag(Blueprint, VarName, /*bNewBlueprintOnly*/ false);
+			FBlueprintEditorUtils::SetBlueprintVariableMetaData(Blueprint, VarName, nullptr, FBlueprintMetadata::MD_ExposeOnSpawn, TEXT("true"));
+		}
+
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		return Blueprint;
+	}
+
+	// Spawns one node of the requested kind and returns it with all pins allocated and class selected
+	UEdGraphNode* SpawnNode(UEdGraph* Graph, EVariant Variant, ENodeKind Kind, UClass* TargetClass)
+	{
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+		if (Kind == ENodeKind::CreateWidget)
+		{
+			if (Variant == EVariant::Stock)
+			{
+				FGraphNodeCreator<UK2Node_CreateWidget> Creator(*Graph);
+				UK2Node_CreateWidget* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+				Creator.Finalize();
+				Schema->TrySetDefaultObject(*Node->FindPinChecked(UK2Node_CowCreateWidgetAsync::WidgetClass, EGPD_Input), TargetClass);
+				return Node;
+			}
+
+			FGraphNodeCreator<UK2Node_CowCreateWidgetAsync> Creator(*Graph);
+			UK2Node_CowCreateWidgetAsync* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+			Creator.Finalize();
+			Schema->TrySetDefaultValue(*Node->GetSoftWidgetPin(), TargetClass->GetPathName());
+			return Node;
+		}
+
+		if (Variant == EVariant::Stock)
+		{
+			FGraphNodeCreator<UK2Node_CallFunction> Creator(*Graph);
+			UK2Node_CallFunction* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+			Node->SetFromFunction(UGameplayStatics::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetAllActorsOfClass)));
+			Creator.Finalize();
+			Schema->TrySetDefaultObject(*Node->FindPinChecked(TEXT("ActorClass"), EGPD_Input), TargetClass);
+			return Node;
+		}
+
+		FGraphNodeCreator<UK2Node_CowGetAllActorsOfClass> Creator(*Graph);
+		UK2Node_CowGetAllActorsOfClass* Node = Creator.CreateNode(/*bSelectNewNode*/ false);
+		Creator.Finalize();
+		Schema->TrySetDefaultValue(*Node->FindPinChecked(UK2Node_CowGetAllActorsOfClass::ActorClassName, EGPD_Input), TargetClass->GetPathName());
+		return Node;
+	}
+
+	// Actor Blueprint with NodeCount nodes chained from BeginPlay
+	UBlueprint* CreateTestBlueprint(EVariant Variant, ENodeKind Kind, int32 NodeCount, int32 ExposedCount, UClass* TargetClass)
+	{
+		const FString AssetName = FString::Printf(TEXT("BP_CowBenchmark_%s_%s_%d_%d"), LexToString(Variant), LexToString(Kind), NodeCount, ExposedCount);
+		UBlueprint* Blueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(AActor::StaticClass(), AssetName);
+		UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+		check(EventGraph);
+
+		static const FName BeginPlayName = TEXT("ReceiveBeginPlay");
+		UK2Node_Event* BeginPlay = FBlueprintEditorUtils::FindOverrideForFunction(Blueprint, AActor::StaticClass(), BeginPlayName);
+		if (!BeginPlay)
+		{
+			int32 NodePosY = 0;
+			BeginPlay = FKismetEditorUtilities::AddDefaultEventNode(Blueprint, EventGraph, BeginPlayName, AActor::StaticClass(), NodePosY);
+		}
+		check(BeginPlay);
+		// Default events are placed as disabled "ghost" nodes
+		BeginPlay->SetEnabledState(ENodeEnabledState::Enabled, /*bUserAction*/ false);
+
+		UEdGraphPin* LastThen = BeginPlay->FindPinChecked(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+		for (int32 Index = 0; Index < NodeCount; ++Index)
+		{
+			UEdGraphNode* Node = SpawnNode(EventGraph, Variant, Kind, TargetClass);
+			LastThen->MakeLinkTo(Node->FindPinChecked(UEdGraphSchema_K2::PN_Execute, EGPD_Input));
+			LastThen = Node->FindPinChecked(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+		}
+
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		return Blueprint;
+	}
+
+	struct FResult
+	{
+		EVariant Variant;
+		ENodeKind Kind;
+		int32 NodeCount = 0;
+		int32 ExposedCount = 0;
+
+		TArray<double> CompileMs;
+		TArray<double> ExpansionMs;
+		int32 ExpandedNodes = 0;
+		int32 IntermediateNodes = 0;
+		int32 BytecodeBytes = 0;
+		int32 Errors = 0;
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Variant,Node,NodeCount,ExposedCount,Iterations,CompileMedianMs,CompileMinMs,CompileMaxMs,ExpansionMedianMs,ExpandedNodes,IntermediateNodes,BytecodeBytes,Errors");
+		}
+
+		FString ToCsvRow() const
+		{
+			// Expansion time of stock nodes isn't instrumented, leave the column empty instead of reporting misleading zero
+			const FString Expansion = Variant == EVariant::Stock ? FString() : FString::Printf(TEXT("%.3f"), FCowBenchmarkUtilities::Median(ExpansionMs));
+			return FString::Printf(TEXT("%s,%s,%d,%d,%d,%.3f,%.3f,%.3f,%s,%d,%d,%d,%d"),
+				LexToString(Variant), LexToString(Kind), NodeCount, ExposedCount, CompileMs.Num(),
+				FCowBenchmarkUtilities::Median(CompileMs), FMath::Min(CompileMs), FMath::Max(CompileMs),
+				*Expansion, ExpandedNodes, IntermediateNodes, BytecodeBytes, Errors);
+		}
+	};
+
+	int32 CountIntermediateNodes(const UBlueprint* Blueprint)
+	{
+		int32 Count = 0;
+		for (const UEdGraph* Graph : Blueprint->IntermediateGeneratedGraphs)
+		{
+			Count += Graph ? Graph->Nodes.Num() : 0;
+		}
+		return Count;
+	}
+
+	int32 CalculateBytecodeSize(const UClass* Class)
+	{
+		int32 Size = 0;
+		for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+		{
+			Size += FunctionIt->Script.Num();
+		}
+		return Size;
+	}
+
+	void Measure(UBlueprint* Blueprint, int32 Iterations, FResult& OutResult)
+	{
+		FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+
+		auto Compile = [Blueprint](EBlueprintCompileOptions ExtraOptions, FCompilerResultsLog& Results)
+		{
+			Results.bSilentMode = true;
+			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave | ExtraOptions, &Results);
+		};
+
+		// Warm up, first compilation pays for loading/caching everything the nodes touch
+		{
+			FCompilerResultsLog Results;
+			Compile(EBlueprintCompileOptions::None, Results);
+		}
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			ExpansionStats = {};
+
+			FCompilerResultsLog Results;
+			const double StartTime = FPlatformTime::Seconds();
+			Compile(EBlueprintCompileOptions::None, Results);
+			OutResult.CompileMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+			OutResult.ExpansionMs.Add(ExpansionStats.Seconds * 1000.0);
+			OutResult.ExpandedNodes = ExpansionStats.ExpandedNodes;
+			OutResult.Errors = FMath::Max(OutResult.Errors, Results.NumErrors);
+		}
+
+		// Separate compilation that keeps intermediate graphs, so it doesn't affect the timings above
+		{
+			FCompilerResultsLog Results;
+			Compile(EBlueprintCompileOptions::SaveIntermediateProducts, Results);
+			OutResult.IntermediateNodes = CountIntermediateNodes(Blueprint);
+			OutResult.BytecodeBytes = CalculateBytecodeSize(Blueprint->GeneratedClass);
+		}
+	}
+}
+
+UCowNodesBenchmarkCommandlet::UCowNodesBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Measures Blueprint compilation cost of Cow nodes compared to stock CreateWidget and GetAllActorsOfClass");
+	HelpUsage = TEXT("-run=CowNodesBenchmark [-NodeCounts=1,10,100] [-ExposedCounts=0,4,16] [-Iterations=5] [-Output=<Path>.csv]");
+}
+
+int32 UCowNodesBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace CowNodesBenchmark;
+
+	const TArray<int32> NodeCounts = FCowBenchmarkUtilities::ParseIntList(Params, TEXT("NodeCounts="), { 1, 10, 100 });
+	const TArray<int32> ExposedCounts = FCowBenchmarkUtilities::ParseIntList(Params, TEXT("ExposedCounts="), { 0, 4, 16 });
+	int32 Iterations = 5;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	// Benchmark toggles code generation mode, restore whatever user has
+	UCowNodesSettings* Settings = GetMutableDefault<UCowNodesSettings>();
+	const bool bOriginalCompactCodeGeneration = Settings->bCompactCodeGeneration;
+
+	UBlueprint* ActorBlueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(AActor::StaticClass(), TEXT("BP_CowBenchmarkActor"));
+	FKismetEditorUtilities::CompileBlueprint(ActorBlueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+
+	TMap<int32, UWidgetBlueprint*> WidgetBlueprints;
+	for (const int32 ExposedCount : ExposedCounts)
+	{
+		WidgetBlueprints.Add(ExposedCount, CreateWidgetBlueprint(ExposedCount));
+	}
+
+	TArray<FString> Rows;
+	int32 TotalErrors = 0;
+
+	for (const EVariant Variant : { EVariant::CowCompact, EVariant::CowLegacy, EVariant::Stock })
+	{
+		Settings->bCompactCodeGeneration = Variant != EVariant::CowLegacy;
+
+		for (const ENodeKind Kind : { ENodeKind::CreateWidget, ENodeKind::GetAllActorsOfClass })
+		{
+			// ExposeOnSpawn variables affect only widget nodes
+			const TArray<int32> KindExposedCounts = Kind == ENodeKind::CreateWidget ? ExposedCounts : TArray<int32>{ 0 };
+
+			for (const int32 ExposedCount : KindExposedCounts)
+			{
+				UClass* TargetClass = Kind == ENodeKind::CreateWidget ? WidgetBlueprints[ExposedCount]->GeneratedClass : ActorBlueprint->GeneratedClass;
+
+				for (const int32 NodeCount : NodeCounts)
+				{
+					FResult Result;
+					Result.Variant = Variant;
+					Result.Kind = Kind;
+					Result.NodeCount = NodeCount;
+					Result.ExposedCount = ExposedCount;
+
+					UBlueprint* TestBlueprint = CreateTestBlueprint(Variant, Kind, NodeCount, ExposedCount, TargetClass);
+					Measure(TestBlueprint, Iterations, Result);
+					TotalErrors += Result.Errors;
+
+					UE_LOG(LogCowNodesBenchmark, Display, TEXT("%-10s %-20s Nodes=%-5d Exposed=%-3d Compile=%.2fms Expansion=%.2fms Intermediate=%d Bytecode=%d Errors=%d"),
+						LexToString(Variant), LexToString(Kind), NodeCount, ExposedCount,
+						FCowBenchmarkUtilities::Median(Result.CompileMs), FCowBenchmarkUtilities::Median(Result.ExpansionMs),
+						Result.IntermediateNodes, Result.BytecodeBytes, Result.Errors);
+
+					Rows.Add(Result.ToCsvRow());
+				}
+			}
+		}
+	}
+
+	Settings->bCompactCodeGeneration = bOriginalCompactCodeGeneration;
+
+	const FString OutputPath = FCowBenchmarkUtilities::GetOutputPath(Params, TEXT("CompileBenchmark.csv"));
+	const bool bWritten = FCowBenchmarkUtilities::WriteCsv(OutputPath, FResult::GetCsvHeader(), Rows);
+
+	if (TotalErrors > 0)
+	{
+		UE_LOG(LogCowNodesBenchmark, Error, TEXT("%d compilation errors, results may be meaningless"), TotalErrors);
+	}
+	return bWritten && TotalErrors == 0 ? 0 : 1;
+}
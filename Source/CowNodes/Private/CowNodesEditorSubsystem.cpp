@@ -0,0 +1,194 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowNodesEditorSubsystem.h"
+
+// Engine
+#include "Editor.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+
+// Cow
+#include "CowCompilerUtilities.h"
+
+UCowNodesEditorSubsystem* UCowNodesEditorSubsystem::Get()
+{
+	return GEditor ? GEditor->GetEditorSubsystem<UCowNodesEditorSubsystem>() : nullptr;
+}
+
+void UCowNodesEditorSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(PendingTickHandle);
+	PendingTickHandle.Reset();
+	PendingBlueprints.Reset();
+
+	for (auto& [Key, Tracked] : TrackedBlueprints)
+	{
+		UnbindBlueprint(Tracked);
+	}
+	TrackedBlueprints.Reset();
+	NodeToBlueprint.Reset();
+
+	Super::Deinitialize();
+}
+
+void UCowNodesEditorSubsystem::RegisterNode(const UEdGraphNode* Node, UClass* Class, FSimpleDelegate OnSignatureChanged)
+{
+	check(Node);
+
+	UBlueprint* Blueprint = nullptr;
+	if (UBlueprintGeneratedClass* BlueprintClass = Cast<UBlueprintGeneratedClass>(Class))
+	{
+		Blueprint = Cast<UBlueprint>(BlueprintClass->ClassGeneratedBy);
+	}
+
+	const TObjectKey<UEdGraphNode> NodeKey(Node);
+	if (const TObjectKey<UBlueprint>* ExistingBlueprint = NodeToBlueprint.Find(NodeKey))
+	{
+		if (*ExistingBlueprint == TObjectKey<UBlueprint>(Blueprint))
+		{
+			return;
+		}
+		UnregisterNode(Node);
+	}
+
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	const TObjectKey<UBlueprint> BlueprintKey(Blueprint);
+	FTrackedBlueprint* Tracked = TrackedBlueprints.Find(BlueprintKey);
+	if (!Tracked)
+	{
+		Tracked = &TrackedBlueprints.Add(BlueprintKey);
+		Tracked->Blueprint = Blueprint;
+		Tracked->Signature = CalculateExposeOnSpawnSignature(Blueprint->GeneratedClass);
+		Tracked->OnChangedHandle = Blueprint->OnChanged().AddUObject(this, &UCowNodesEditorSubsystem::OnBlueprintChanged);
+	}
+
+	Tracked->Nodes.Add({ Node, MoveTemp(OnSignatureChanged) });
+	NodeToBlueprint.Add(NodeKey, BlueprintKey);
+}
+
+void UCowNodesEditorSubsystem::UnregisterNode(const UEdGraphNode* Node)
+{
+	TObjectKey<UBlueprint> BlueprintKey;
+	if (!NodeToBlueprint.RemoveAndCopyValue(TObjectKey<UEdGraphNode>(Node), BlueprintKey))
+	{
+		return;
+	}
+
+	if (FTrackedBlueprint* Tracked = TrackedBlueprints.Find(BlueprintKey))
+	{
+		Tracked->Nodes.RemoveAllSwap([Node](const FTrackedNode& TrackedNode)
+		{
+			return TrackedNode.Node.Get(/*bEvenIfPendingKill*/ true) == Node;
+		});
+
+		// Last user of the Blueprint is gone, no reason to keep listening
+		if (Tracked->Nodes.IsEmpty())
+		{
+			UnbindBlueprint(*Tracked);
+			TrackedBlueprints.Remove(BlueprintKey);
+			PendingBlueprints.Remove(BlueprintKey);
+		}
+	}
+}
+
+uint32 UCowNodesEditorSubsystem::CalculateExposeOnSpawnSignature(const UClass* Class)
+{
+	if (!Class)
+	{
+		return 0;
+	}
+
+	const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+	uint32 Signature = 0;
+	for (TFieldIterator<FProperty> PropertyIt(Class, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
+	{
+		const FProperty* Property = *PropertyIt;
+		if (!FCowCompilerUtilities::IsExposedOnSpawnProperty(Property))
+		{
+			continue;
+		}
+
+		FEdGraphPinType PinType;
+		Schema->ConvertPropertyToPinType(Property, PinType);
+
+		Signature = HashCombine(Signature, GetTypeHash(Property->GetFName()));
+		Signature = HashCombine(Signature, GetTypeHash(PinType.PinCategory));
+		Signature = HashCombine(Signature, GetTypeHash(PinType.PinSubCategory));
+		Signature = HashCombine(Signature, GetTypeHash(PinType.PinSubCategoryObject.Get()));
+		Signature = HashCombine(Signature, GetTypeHash(static_cast<uint8>(PinType.ContainerType)));
+		Signature = HashCombine(Signature, GetTypeHash(Property->HasAnyPropertyFlags(CPF_AdvancedDisplay)));
+	}
+	return Signature;
+}
+
+void UCowNodesEditorSubsystem::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	// Blueprint compilation may broadcast OnChanged several times in a row (and for each child Blueprint)
+	// Just remember it and do the actual work once on the next tick
+	PendingBlueprints.Add(Blueprint);
+
+	if (!PendingTickHandle.IsValid())
+	{
+		PendingTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UCowNodesEditorSubsystem::ProcessPendingChanges));
+	}
+}
+
+bool UCowNodesEditorSubsystem::ProcessPendingChanges(float DeltaTime)
+{
+	PendingTickHandle.Reset();
+
+	// Refreshing a node may (un)register nodes, so work on a copy
+	TSet<TObjectKey<UBlueprint>> Pending = MoveTemp(PendingBlueprints);
+	PendingBlueprints.Reset();
+
+	for (const TObjectKey<UBlueprint>& BlueprintKey : Pending)
+	{
+		FTrackedBlueprint* Tracked = TrackedBlueprints.Find(BlueprintKey);
+		if (!Tracked)
+		{
+			continue;
+		}
+
+		UBlueprint* Blueprint = Tracked->Blueprint.Get();
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		const uint32 NewSignature = CalculateExposeOnSpawnSignature(Blueprint->GeneratedClass);
+		if (NewSignature == Tracked->Signature)
+		{
+			continue;
+		}
+		Tracked->Signature = NewSignature;
+
+		TArray<FTrackedNode> NodesToRefresh = Tracked->Nodes;
+		for (const FTrackedNode& TrackedNode : NodesToRefresh)
+		{
+			if (TrackedNode.Node.IsValid())
+			{
+				TrackedNode.OnSignatureChanged.ExecuteIfBound();
+			}
+		}
+	}
+
+	// One shot ticker
+	return false;
+}
+
+void UCowNodesEditorSubsystem::UnbindBlueprint(FTrackedBlueprint& Tracked)
+{
+	if (UBlueprint* Blueprint = Tracked.Blueprint.Get())
+	{
+		Blueprint->OnChanged().Remove(Tracked.OnChangedHandle);
+	}
+	Tracked.OnChangedHandle.Reset();
+	Tracked.Blueprint.Reset();
+}
@@ -0,0 +1,13 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowNodesSettings.h"
+
+UCowNodesSettings::UCowNodesSettings()
+{
+	CategoryName = TEXT("Plugins");
+}
+
+bool UCowNodesSettings::UseCompactCodeGeneration()
+{
+	return GetDefault<UCowNodesSettings>()->bCompactCodeGeneration;
+}
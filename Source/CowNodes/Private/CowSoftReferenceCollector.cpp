@@ -0,0 +1,195 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowSoftReferenceCollector.h"
+
+// Engine
+#include "AssetRegistry/AssetBundleData.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_MakeArray.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+// Cow
+#include "CowNodesSettings.h"
+#include "CowSoftReferenceManifest.h"
+#include "K2Node_CowConstructObjectAsync.h"
+#include "K2Node_CowCreateWidgetAsync.h"
+#include "K2Node_CowLoadAssets.h"
+#include "K2Node_CowSpawnActorAsync.h"
+
+namespace
+{
+	// Same tag UPrimaryDataAsset::AssetBundleData is written to, asset manager reads it with FAssetData::GetTaggedAssetBundles
+	const FName AssetBundleDataTagName = TEXT("AssetBundleData");
+
+	FDelegateHandle GetExtraObjectTagsHandle;
+
+	// CowSpawnActorsBatched is a child of CowSpawnActorAsync
+	bool IsLoadingCowNode(const UEdGraphNode* Node)
+	{
+		return Node->IsA<UK2Node_CowCreateWidgetAsync>()
+			|| Node->IsA<UK2Node_CowSpawnActorAsync>()
+			|| Node->IsA<UK2Node_CowConstructObjectAsync>()
+			|| Node->IsA<UK2Node_CowLoadAssets>();
+	}
+
+	void CollectPinValue(const UEdGraphPin* Pin, TArray<FSoftObjectPath>& OutPaths)
+	{
+		const FName Category = Pin->PinType.PinCategory;
+		if (Pin->Direction == EGPD_Input && Pin->LinkedTo.IsEmpty() && !Pin->DefaultValue.IsEmpty()
+			&& (Category == UEdGraphSchema_K2::PC_SoftClass || Category == UEdGraphSchema_K2::PC_SoftObject))
+		{
+			OutPaths.Add(FSoftObjectPath(Pin->DefaultValue));
+		}
+	}
+
+	void CollectFromNode(const UEdGraphNode* Node, TArray<FSoftObjectPath>& OutPaths)
+	{
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			CollectPinValue(Pin, OutPaths);
+
+			// Arrays have no default value, CowLoadAssets gets its assets from MakeArray
+			if (Pin->Direction == EGPD_Input && Pin->PinType.IsArray())
+			{
+				for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					if (const UK2Node_MakeArray* MakeArray = Cast<UK2Node_MakeArray>(LinkedPin->GetOwningNode()))
+					{
+						for (const UEdGraphPin* ElementPin : MakeArray->Pins)
+						{
+							CollectPinValue(ElementPin, OutPaths);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Class and all of its parent Blueprints, Visited prevents collecting the same Blueprint for every placed instance
+	void CollectFromClass(const UClass* Class, TSet<const UBlueprint*>& Visited, TArray<FSoftObjectPath>& OutPaths)
+	{
+		for (; Class; Class = Class->GetSuperClass())
+		{
+			const UBlueprint* Blueprint = UBlueprint::GetBlueprintFromClass(Class);
+			if (!Blueprint)
+			{
+				// Native from here on
+				return;
+			}
+
+			bool bAlreadyVisited = false;
+			Visited.Add(Blueprint, &bAlreadyVisited);
+			if (bAlreadyVisited)
+			{
+				return;
+			}
+			FCowSoftReferenceCollector::CollectFromBlueprint(Blueprint, OutPaths);
+		}
+	}
+
+	void AddAssetBundleTag(FAssetRegistryTagsContext& Context, TConstArrayView<FSoftObjectPath> Paths)
+	{
+		TArray<FTopLevelAssetPath> AssetPaths;
+		AssetPaths.Reserve(Paths.Num());
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			AssetPaths.AddUnique(Path.GetAssetPath());
+		}
+
+		FAssetBundleData BundleData;
+		BundleData.AddBundleAssets(FCowSoftReferenceManifest::BundleName, AssetPaths);
+
+		FString Value;
+		FAssetBundleData::StaticStruct()->ExportText(Value, &BundleData, nullptr, nullptr, PPF_None, nullptr);
+		Context.AddTag(UObject::FAssetRegistryTag(AssetBundleDataTagName, Value, UObject::FAssetRegistryTag::TT_Hidden));
+	}
+
+	void OnGetExtraObjectTags(FAssetRegistryTagsContext Context)
+	{
+		const UCowNodesSettings* Settings = GetDefault<UCowNodesSettings>();
+		if (!Settings->bWriteSoftReferenceManifest)
+		{
+			return;
+		}
+
+		TArray<FSoftObjectPath> Paths;
+		const UWorld* World = Cast<UWorld>(Context.GetObject());
+		if (World)
+		{
+			FCowSoftReferenceCollector::CollectFromWorld(World, Paths);
+		}
+		else if (const UBlueprint* Blueprint = Cast<UBlueprint>(Context.GetObject()))
+		{
+			FCowSoftReferenceCollector::CollectFromBlueprint(Blueprint, Paths);
+		}
+
+		if (Paths.IsEmpty())
+		{
+			return;
+		}
+
+		Context.AddTag(UObject::FAssetRegistryTag(FCowSoftReferenceManifest::TagName, FCowSoftReferenceManifest::MakeTagValue(Paths), UObject::FAssetRegistryTag::TT_Hidden));
+
+		// Maps don't write bundle data themselves, so there is nothing to merge with
+		if (World && Settings->bRegisterAssetBundles)
+		{
+			AddAssetBundleTag(Context, Paths);
+		}
+	}
+}
+
+void FCowSoftReferenceCollector::CollectFromBlueprint(const UBlueprint* Blueprint, TArray<FSoftObjectPath>& OutPaths)
+{
+	TArray<UEdGraph*> Graphs;
+	Blueprint->GetAllGraphs(Graphs);
+	for (const UEdGraph* Graph : Graphs)
+	{
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node && IsLoadingCowNode(Node))
+			{
+				CollectFromNode(Node, OutPaths);
+			}
+		}
+	}
+}
+
+void FCowSoftReferenceCollector::CollectFromWorld(const UWorld* World, TArray<FSoftObjectPath>& OutPaths)
+{
+	ULevel* Level = World->PersistentLevel;
+	if (!Level)
+	{
+		return;
+	}
+
+	TSet<const UBlueprint*> Visited;
+	if (const UBlueprint* LevelBlueprint = Level->GetLevelScriptBlueprint(/*bDontCreate*/ true))
+	{
+		Visited.Add(LevelBlueprint);
+		CollectFromBlueprint(LevelBlueprint, OutPaths);
+	}
+
+	for (const AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			CollectFromClass(Actor->GetClass(), Visited, OutPaths);
+		}
+	}
+}
+
+void FCowSoftReferenceCollector::Register()
+{
+	GetExtraObjectTagsHandle = FCoreUObjectDelegates::GetExtraObjectTagsWithContext.AddStatic(&OnGetExtraObjectTags);
+}
+
+void FCowSoftReferenceCollector::Unregister()
+{
+	FCoreUObjectDelegates::GetExtraObjectTagsWithContext.Remove(GetExtraObjectTagsHandle);
+	GetExtraObjectTagsHandle.Reset();
+}
@@ -0,0 +1,359 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowWidgetLatencyBenchmarkCommandlet.h"
+
+// Engine
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_VariableGet.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Tickable.h"
+#include "UObject/UObjectArray.h"
+#include "WidgetBlueprint.h"
+
+// Cow
+#include "CowBenchmarkUtilities.h"
+#include "CowCreateWidgetAsyncAction.h"
+#include "CowNodesSettings.h"
+#include "K2Node_CowCreateWidgetAsync.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowWidgetLatencyBenchmark, Log, All);
+
+namespace CowWidgetLatencyBenchmark
+{
+	constexpr float FrameDeltaSeconds = 1.f / 60.f;
+	// Per frame async loading budget, same as default s.AsyncLoadingTimeLimit
+	constexpr double AsyncLoadingTimeLimit = 0.005;
+	constexpr int32 MaxFramesPerBurst = 600;
+
+	const FName HarnessRequestEventName = TEXT("CowBenchmarkRequest");
+	const FName HarnessWidgetClassName = TEXT("WidgetClass");
+
+	// Completion timestamps of the current burst (everything runs on the game thread)
+	struct FProbe
+	{
+		int32 CurrentFrame = 0;
+		TArray<double> CompletionSeconds;
+		TArray<int32> CompletionFrames;
+		int32 NullWidgets = 0;
+
+		void Reset()
+		{
+			CurrentFrame = 0;
+			CompletionSeconds.Reset();
+			CompletionFrames.Reset();
+			NullWidgets = 0;
+		}
+
+		void Record(const UUserWidget* Widget)
+		{
+			CompletionSeconds.Add(FPlatformTime::Seconds());
+			CompletionFrames.Add(CurrentFrame);
+			NullWidgets += Widget ? 0 : 1;
+		}
+	};
+	FProbe GProbe;
+
+	enum class EPath : uint8
+	{
+		BlueprintCompact,
+		BlueprintLegacy,
+		Native
+	};
+
+	const TCHAR* LexToString(EPath Path)
+	{
+		switch (Path)
+		{
+			case EPath::BlueprintCompact: return TEXT("BlueprintCompact");
+			case EPath::BlueprintLegacy:  return TEXT("BlueprintLegacy");
+			default:					  return TEXT("Native");
+		}
+	}
+
+	/**
+	 * Actor Blueprint:
+	 *	CowBenchmarkRequest (custom event) -> CowCreateWidgetAsync(SoftWidgetClass = WidgetClass variable) -> OnWidgetCreated -> NotifyWidgetCreated(Result)
+	 */
+	UClass* CreateHarnessClass(const TCHAR* AssetName)
+	{
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+		UBlueprint* Blueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(AActor::StaticClass(), AssetName);
+		UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+		check(EventGraph);
+
+		FEdGraphPinType WidgetClassType;
+		WidgetClassType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
+		WidgetClassType.PinSubCategoryObject = UUserWidget::StaticClass();
+		FBlueprintEditorUtils::AddMemberVariable(Blueprint, HarnessWidgetClassName, WidgetClassType);
+
+		FGraphNodeCreator<UK2Node_CustomEvent> EventCreator(*EventGraph);
+		UK2Node_CustomEvent* RequestEvent = EventCreator.CreateNode(/*bSelectNewNode*/ false);
+		RequestEvent->CustomFunctionName = HarnessRequestEventName;
+		EventCreator.Finalize();
+
+		FGraphNodeCreator<UK2Node_VariableGet> GetterCreator(*EventGraph);
+		UK2Node_VariableGet* WidgetClassGetter = GetterCreator.CreateNode(/*bSelectNewNode*/ false);
+		WidgetClassGetter->VariableReference.SetSelfMember(HarnessWidgetClassName);
+		GetterCreator.Finalize();
+
+		FGraphNodeCreator<UK2Node_CowCreateWidgetAsync> CreateWidgetCreator(*EventGraph);
+		UK2Node_CowCreateWidgetAsync* CreateWidget = CreateWidgetCreator.CreateNode(/*bSelectNewNode*/ false);
+		CreateWidgetCreator.Finalize();
+
+		FGraphNodeCreator<UK2Node_CallFunction> NotifyCreator(*EventGraph);
+		UK2Node_CallFunction* Notify = NotifyCreator.CreateNode(/*bSelectNewNode*/ false);
+		Notify->SetFromFunction(UCowWidgetLatencyBenchmarkCommandlet::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowWidgetLatencyBenchmarkCommandlet, NotifyWidgetCreated)));
+		NotifyCreator.Finalize();
+
+		// TryCreateConnection to let the node propagate linked class (and pin types) the same way it happens in the editor
+		Schema->TryCreateConnection(RequestEvent->FindPinChecked(UEdGraphSchema_K2::PN_Then, EGPD_Output), CreateWidget->GetExecPin());
+		Schema->TryCreateConnection(WidgetClassGetter->FindPinChecked(HarnessWidgetClassName, EGPD_Output), CreateWidget->GetSoftWidgetPin());
+		Schema->TryCreateConnection(CreateWidget->FindPinChecked(UK2Node_CowCreateWidgetAsync::WidgetCreated, EGPD_Output), Notify->GetExecPin());
+		Schema->TryCreateConnection(CreateWidget->GetResultPin(), Notify->FindPinChecked(TEXT("Widget"), EGPD_Input));
+
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		return Blueprint->GeneratedClass;
+	}
+
+	struct FBenchmarkWorld
+	{
+		UGameInstance* GameInstance = nullptr;
+		UWorld* World = nullptr;
+
+		void Create()
+		{
+			// Game instance keeps async actions alive (UBlueprintAsyncActionBase::RegisterWithGameInstance)
+			GameInstance = NewObject<UGameInstance>(GEngine);
+			GameInstance->AddToRoot();
+			GameInstance->InitializeStandalone(TEXT("CowWidgetLatencyBenchmark"));
+			World = GameInstance->GetWorld();
+		}
+
+		void Destroy()
+		{
+			GameInstance->Shutdown();
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+			GameInstance->RemoveFromRoot();
+			GameInstance = nullptr;
+			World = nullptr;
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		// Everything engine does for a game world each frame that matters for async widget creation, returns game thread ms
+		double TickFrame() const
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			ProcessAsyncLoading(/*bUseTimeLimit*/ true, /*bUseFullTimeLimit*/ false, AsyncLoadingTimeLimit);
+			World->Tick(LEVELTICK_All, FrameDeltaSeconds);
+			// Streamable manager delays completion delegates through a world-less tickable
+			FTickableGameObject::TickObjects(nullptr, LEVELTICK_All, /*bIsPaused*/ false, FrameDeltaSeconds);
+			FTSTicker::GetCoreTicker().Tick(FrameDeltaSeconds);
+
+			return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+	};
+
+	struct FResult
+	{
+		FString Scenario;
+		EPath Path = EPath::Native;
+		int32 Burst = 0;
+		bool bActuallyCold = false;
+
+		TArray<double> LatencyMs;
+		TArray<double> LatencyFrames;
+		double WorstFrameMs = 0.0;
+		int32 Completed = 0;
+		int32 NullWidgets = 0;
+		int32 ObjectsDelta = 0;
+		double GCMs = 0.0;
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Scenario,Path,Burst,ActuallyCold,Completed,NullWidgets,MedianLatencyMs,MaxLatencyMs,MedianLatencyFrames,MaxLatencyFrames,WorstFrameMs,ObjectsDelta,GCMs");
+		}
+
+		FString ToCsvRow() const
+		{
+			return FString::Printf(TEXT("%s,%s,%d,%d,%d,%d,%.3f,%.3f,%.0f,%.0f,%.3f,%d,%.3f"),
+				*Scenario, LexToString(Path), Burst, bActuallyCold ? 1 : 0, Completed, NullWidgets,
+				FCowBenchmarkUtilities::Median(LatencyMs), FCowBenchmarkUtilities::Percentile(LatencyMs, 100.0),
+				FCowBenchmarkUtilities::Median(LatencyFrames), FCowBenchmarkUtilities::Percentile(LatencyFrames, 100.0),
+				WorstFrameMs, ObjectsDelta, GCMs);
+		}
+	};
+}
+
+UCowWidgetLatencyBenchmarkCommandlet::UCowWidgetLatencyBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Measures latency, hitches and GC churn of CowCreateWidgetAsync (Blueprint and native) in a headless world");
+	HelpUsage = TEXT("-run=CowWidgetLatencyBenchmark [-Bursts=1,10,100] [-Repeats=5] [-ColdWidget=<SoftClassPath>] [-Output=<Path>.csv]");
+}
+
+void UCowWidgetLatencyBenchmarkCommandlet::NotifyWidgetCreated(UUserWidget* Widget)
+{
+	CowWidgetLatencyBenchmark::GProbe.Record(Widget);
+}
+
+void UCowWidgetLatencyBenchmarkCommandlet::OnNativeWidgetCreated(UUserWidget* Widget)
+{
+	CowWidgetLatencyBenchmark::GProbe.Record(Widget);
+}
+
+int32 UCowWidgetLatencyBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace CowWidgetLatencyBenchmark;
+
+	const TArray<int32> Bursts = FCowBenchmarkUtilities::ParseIntList(Params, TEXT("Bursts="), { 1, 10, 100 });
+	int32 Repeats = 5;
+	FParse::Value(*Params, TEXT("Repeats="), Repeats);
+	Repeats = FMath::Max(Repeats, 1);
+
+	// Warm scenario uses generated widget, it's never unloaded while the commandlet runs
+	UBlueprint* WarmWidgetBlueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(UUserWidget::StaticClass(), TEXT("WBP_CowLatencyBenchmark"),
+																					   UWidgetBlueprint::StaticClass(), UWidgetBlueprintGeneratedClass::StaticClass());
+	FKismetEditorUtilities::CompileBlueprint(WarmWidgetBlueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+
+	TArray<TPair<FString, FSoftObjectPath>> Scenarios;
+	Scenarios.Emplace(TEXT("Warm"), FSoftObjectPath(WarmWidgetBlueprint->GeneratedClass));
+
+	FString ColdWidget;
+	if (FParse::Value(*Params, TEXT("ColdWidget="), ColdWidget))
+	{
+		Scenarios.Emplace(TEXT("Cold"), FSoftObjectPath(ColdWidget));
+	}
+
+	// Harness is compiled in both code generation modes
+	UCowNodesSettings* Settings = GetMutableDefault<UCowNodesSettings>();
+	const bool bOriginalCompactCodeGeneration = Settings->bCompactCodeGeneration;
+	Settings->bCompactCodeGeneration = true;
+	UClass* CompactHarnessClass = CreateHarnessClass(TEXT("BP_CowLatencyHarnessCompact"));
+	Settings->bCompactCodeGeneration = false;
+	UClass* LegacyHarnessClass = CreateHarnessClass(TEXT("BP_CowLatencyHarnessLegacy"));
+	Settings->bCompactCodeGeneration = bOriginalCompactCodeGeneration;
+
+	TArray<FString> Rows;
+	int32 TotalMissing = 0;
+
+	for (const TPair<FString, FSoftObjectPath>& Scenario : Scenarios)
+	{
+		const bool bCold = Scenario.Key == TEXT("Cold");
+
+		for (const EPath Path : { EPath::BlueprintCompact, EPath::BlueprintLegacy, EPath::Native })
+		{
+			for (const int32 Burst : Bursts)
+			{
+				for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+				{
+					FBenchmarkWorld BenchmarkWorld;
+					BenchmarkWorld.Create();
+
+					FResult Result;
+					Result.Scenario = Scenario.Key;
+					Result.Path = Path;
+					Result.Burst = Burst;
+					// Destroy of the previous world collected garbage, if the class is still around something else holds it
+					Result.bActuallyCold = bCold && !Scenario.Value.ResolveObject();
+
+					// One harness per request: legacy LoadAsset latent action is keyed by the node UUID per object,
+					// so re-triggering the same instance while its load is pending is ignored (only one of the burst would complete)
+					TArray<AActor*> Harnesses;
+					if (Path != EPath::Native)
+					{
+						UClass* HarnessClass = Path == EPath::BlueprintCompact ? CompactHarnessClass : LegacyHarnessClass;
+						FSoftClassProperty* WidgetClassProperty = FindFProperty<FSoftClassProperty>(HarnessClass, HarnessWidgetClassName);
+						for (int32 Index = 0; Index < Burst; ++Index)
+						{
+							AActor* Harness = BenchmarkWorld.World->SpawnActor(HarnessClass);
+							WidgetClassProperty->SetPropertyValue_InContainer(Harness, FSoftObjectPtr(Scenario.Value));
+							Harnesses.Add(Harness);
+						}
+					}
+
+					// Settle the world before measuring
+					BenchmarkWorld.TickFrame();
+					GProbe.Reset();
+					const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+					const double RequestTime = FPlatformTime::Seconds();
+					for (int32 Index = 0; Index < Burst; ++Index)
+					{
+						if (!Harnesses.IsEmpty())
+						{
+							AActor* Harness = Harnesses[Index];
+							Harness->ProcessEvent(Harness->FindFunctionChecked(HarnessRequestEventName), nullptr);
+						}
+						else
+						{
+							UCowCreateWidgetAsyncAction* Action = UCowCreateWidgetAsyncAction::CowCreateWidgetAsync(BenchmarkWorld.World, TSoftClassPtr<UUserWidget>(Scenario.Value), nullptr);
+							Action->Completed.AddDynamic(this, &UCowWidgetLatencyBenchmarkCommandlet::OnNativeWidgetCreated);
+							Action->Activate();
+						}
+					}
+					// Issuing requests is a part of the first frame
+					const double RequestMs = (FPlatformTime::Seconds() - RequestTime) * 1000.0;
+
+					for (int32 Frame = 0; Frame < MaxFramesPerBurst && GProbe.CompletionSeconds.Num() < Burst; ++Frame)
+					{
+						const double FrameMs = BenchmarkWorld.TickFrame() + (Frame == 0 ? RequestMs : 0.0);
+						Result.WorstFrameMs = FMath::Max(Result.WorstFrameMs, FrameMs);
+						++GProbe.CurrentFrame;
+					}
+
+					Result.Completed = GProbe.CompletionSeconds.Num();
+					Result.NullWidgets = GProbe.NullWidgets;
+					for (int32 Index = 0; Index < Result.Completed; ++Index)
+					{
+						Result.LatencyMs.Add((GProbe.CompletionSeconds[Index] - RequestTime) * 1000.0);
+						// Frame N means completion happened during the N+1th tick after the request
+						Result.LatencyFrames.Add(GProbe.CompletionFrames[Index] + 1);
+					}
+					TotalMissing += Burst - Result.Completed;
+
+					// Everything burst created and didn't release is GC churn
+					Result.ObjectsDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+					const double GCStartTime = FPlatformTime::Seconds();
+					CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+					Result.GCMs = (FPlatformTime::Seconds() - GCStartTime) * 1000.0;
+
+					BenchmarkWorld.Destroy();
+
+					UE_LOG(LogCowWidgetLatencyBenchmark, Display, TEXT("%-5s %-16s Burst=%-4d Completed=%-4d Latency=%.2fms (%.0f frames) Max=%.2fms WorstFrame=%.2fms Objects=%d GC=%.2fms"),
+						*Result.Scenario, LexToString(Path), Burst, Result.Completed,
+						FCowBenchmarkUtilities::Median(Result.LatencyMs), FCowBenchmarkUtilities::Median(Result.LatencyFrames),
+						FCowBenchmarkUtilities::Percentile(Result.LatencyMs, 100.0), Result.WorstFrameMs, Result.ObjectsDelta, Result.GCMs);
+
+					Rows.Add(Result.ToCsvRow());
+				}
+			}
+		}
+	}
+
+	const FString OutputPath = FCowBenchmarkUtilities::GetOutputPath(Params, TEXT("WidgetLatencyBenchmark.csv"));
+	const bool bWritten = FCowBenchmarkUtilities::WriteCsv(OutputPath, FResult::GetCsvHeader(), Rows);
+
+	if (TotalMissing > 0)
+	{
+		UE_LOG(LogCowWidgetLatencyBenchmark, Error, TEXT("%d requests never completed within %d frames"), TotalMissing, MaxFramesPerBurst);
+	}
+	return bWritten && TotalMissing == 0 ? 0 : 1;
+}
@@ -0,0 +1,292 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowConstructObjectAsync.h"
+
+#include "CowCompilerUtilities.h"
+#include "CowConstructObjectAsyncAction.h"
+#include "CowNodesEditorSubsystem.h"
+#include "K2Node_AsyncAction.h"
+#include "KismetCompiler.h"
+#include "Kismet/GameplayStatics.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+UEdGraphPin* UK2Node_CowConstructObjectAsync::GetSoftObjectPin() const
+{
+	return FindPinChecked(SoftObjectClass, EGPD_Input);
+}
+
+FText UK2Node_CowConstructObjectAsync::GetBaseNodeTitle() const
+{
+	return LOCTEXT("CowConstructObjectAsync_BaseTitle", "Cow Construct Object Async");
+}
+
+FText UK2Node_CowConstructObjectAsync::GetNodeTitleFormat() const
+{
+	return LOCTEXT("CowConstructObjectAsync_TitleFormat", "Cow Construct {ClassName} Async");
+}
+
+FText UK2Node_CowConstructObjectAsync::GetTooltipText() const
+{
+	return LOCTEXT("CowConstructObjectAsync_Tooltip", "Loads the soft class asynchronously and constructs an object of it, ExposeOnSpawn variables are assigned before ObjectConstructed");
+}
+
+void UK2Node_CowConstructObjectAsync::TryCreateOnObjectConstructedPin()
+{
+	if (FindPin(ObjectConstructed, EGPD_Output) == nullptr)
+	{
+		FEdGraphPinType PinType;
+		PinType.PinCategory = UEdGraphSchema_K2::PC_Exec;
+		CreatePin(EGPD_Output, PinType, ObjectConstructed, 2);
+	}
+}
+
+void UK2Node_CowConstructObjectAsync::PostReconstructNode()
+{
+	Super::PostReconstructNode();
+
+	// Same as UK2Node_CowCreateWidgetAsync: refresh doesn't call any events we use to fixup the state
+	OnSoftObjectClassChanged();
+}
+
+void UK2Node_CowConstructObjectAsync::PostLoad()
+{
+	// We could have changed dependant class while blueprint with the node was closed, therefore we missed OnChanged event
+	if (HasValidBlueprint())
+	{
+		OnSoftObjectClassChanged();
+	}
+
+	Super::PostLoad();
+}
+
+void UK2Node_CowConstructObjectAsync::BeginDestroy()
+{
+	UnbindFromBlueprintChange();
+
+	Super::BeginDestroy();
+}
+
+void UK2Node_CowConstructObjectAsync::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	// Hide "Class" pin from UK2Node_ConstructObjectFromClass
+	// It is used to reuse parent functionality to spawn ExposedOnSpawn pins from selected class
+	UEdGraphPin* ClassPin = FindPin(ObjectClass, EGPD_Input);
+	check(ClassPin);
+	ClassPin->bHidden = true;
+
+	FEdGraphPinType SoftClassType;
+	SoftClassType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
+	SoftClassType.PinSubCategoryObject = UObject::StaticClass();
+	CreatePin(EGPD_Input, SoftClassType, SoftObjectClass);
+
+	TryCreateOnObjectConstructedPin();
+}
+
+void UK2Node_CowConstructObjectAsync::EarlyValidation(FCompilerResultsLog& MessageLog) const
+{
+	UK2Node_ConstructObjectFromClass::EarlyValidation(MessageLog);
+
+	// Linked class may be any child at runtime, so abstract base is fine (same rule UK2Node_GenericCreateObject uses)
+	const bool bAllowAbstract = IsSoftObjectClassConnected();
+	if (ObjectClassToSpawn && !UGameplayStatics::CanSpawnObjectOfClass(ObjectClassToSpawn, bAllowAbstract))
+	{
+		MessageLog.Error(*FText::Format(LOCTEXT("CowConstructObjectAsync_WrongClassFmt", "Cannot construct objects of type '{0}' in @@"), FText::FromString(GetPathNameSafe(ObjectClassToSpawn))).ToString(), this);
+	}
+}
+
+void UK2Node_CowConstructObjectAsync::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	// On purpose omitted Super::ExpandNode, it expands to UGameplayStatics::SpawnObject with the hard class
+	UK2Node_ConstructObjectFromClass::ExpandNode(CompilerContext, SourceGraph);
+
+	if (ObjectClassToSpawn == nullptr)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("CowConstructObjectAsync_Error", "Construct Object Async node @@ must have a class specified.").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	if (!FCowCompilerUtilities::ValidateSpawnVarPinsNameConflicts(CompilerContext, this, ObjectClassToSpawn, GetInternalPinNames()))
+	{
+		BreakAllNodeLinks();
+		return;
+	}
+
+	UEdGraphPin* This_InputSoftRef = GetSoftObjectPin();
+	if (!This_InputSoftRef->LinkedTo.IsEmpty())
+	{
+		FCowCompilerUtilities::NoteHardRefThroughSoftClassPin(CompilerContext, This_InputSoftRef);
+		FCowCompilerUtilities::NoteSpawnVarPinsMatchingDefaults(CompilerContext, this, ObjectClassToSpawn, GetInternalPinNames());
+	}
+
+	// Graph for better understanding implementation details:
+	//
+	//                                        /> Then (Executed immediately after the action is activated)
+	// UCowConstructObjectAsyncAction -------|
+	// (loads class and constructs object)    \> Completed -> Generate assignments via SetPropertyByName -> ObjectConstructed pin
+
+	UK2Node_AsyncAction* ConstructAction = CompilerContext.SpawnIntermediateNode<UK2Node_AsyncAction>(this, SourceGraph);
+	ConstructAction->InitializeProxyFromFunction(UCowConstructObjectAsyncAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowConstructObjectAsyncAction, CowConstructObjectAsync)));
+	ConstructAction->AllocateDefaultPins();
+	FCowCompilerUtilities::SetNodeGuidPinDefault(CompilerContext, ConstructAction, this);
+
+	UEdGraphPin* Action_InputObjectClass = ConstructAction->FindPinChecked(Action_InputObjectClassName, EGPD_Input);
+	UEdGraphPin* Action_InputOuter = ConstructAction->FindPinChecked(Action_InputOuterName, EGPD_Input);
+	UEdGraphPin* Action_OutputCompleted = ConstructAction->FindPinChecked(Action_OutputCompletedName, EGPD_Output);
+	UEdGraphPin* Action_OutputObject = ConstructAction->FindPinChecked(Action_OutputObjectName, EGPD_Output);
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *ConstructAction->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *ConstructAction->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*This_InputSoftRef, *Action_InputObjectClass);
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(Construct_InputOuter, EGPD_Input), *Action_InputOuter);
+
+	Action_OutputObject->PinType = GetResultPin()->PinType; // (Type match required to connect pins)
+	CompilerContext.MovePinLinksToIntermediate(*GetResultPin(), *Action_OutputObject);
+
+	//////////////////////////////////////////////////////////////////////////
+	// create 'set var' nodes
+	UEdGraphPin* LastThen = FCowCompilerUtilities::GenerateAssignmentNodes(CompilerContext, SourceGraph, ConstructAction, Action_OutputCompleted, this, Action_OutputObject, ObjectClassToSpawn, Action_InputObjectClass);
+
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ObjectConstructed, EGPD_Output), *LastThen);
+
+	BreakAllNodeLinks();
+}
+
+FText UK2Node_CowConstructObjectAsync::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (ObjectClassToSpawn != nullptr)
+	{
+		if (CachedNodeTitle.IsOutOfDate(this))
+		{
+			FFormatNamedArguments Args;
+			Args.Add(TEXT("ClassName"), ObjectClassToSpawn->GetDisplayNameText());
+			// FText::Format() is slow, so we cache this to save on performance
+			CachedNodeTitle.SetCachedText(FText::Format(GetNodeTitleFormat(), Args), this);
+		}
+		return CachedNodeTitle;
+	}
+
+	return GetBaseNodeTitle();
+}
+
+FName UK2Node_CowConstructObjectAsync::GetCornerIcon() const
+{
+	return TEXT("Graph.Latent.LatentIcon");
+}
+
+bool UK2Node_CowConstructObjectAsync::IsCompatibleWithGraph(const UEdGraph* TargetGraph) const
+{
+	// Can only place events in ubergraphs and macros (other code will help prevent macros with latents from ending up in functions)
+	EGraphType GraphType = TargetGraph->GetSchema()->GetGraphType(TargetGraph);
+	const bool bIsCompatible = GraphType == EGraphType::GT_Ubergraph || GraphType == EGraphType::GT_Macro;
+	return bIsCompatible && Super::IsCompatibleWithGraph(TargetGraph);
+}
+
+void UK2Node_CowConstructObjectAsync::CreatePinsForClass(UClass* InClass, TArray<UEdGraphPin*>* OutClassPins)
+{
+	// Prevent Super::CreatePinsForClass to change return type because it will introduce hard-ref to object class
+	UEdGraphPin* ResultPin = GetResultPin();
+	auto CachedPinSubCategoryObject = ResultPin->PinType.PinSubCategoryObject;
+
+	Super::CreatePinsForClass(InClass, OutClassPins);
+
+	ResultPin->PinType.PinSubCategoryObject = CachedPinSubCategoryObject;
+}
+
+void UK2Node_CowConstructObjectAsync::PinDefaultValueChanged(UEdGraphPin* ChangedPin)
+{
+	if (ChangedPin && (ChangedPin->PinName == SoftObjectClass))
+	{
+		OnSoftObjectClassChanged();
+	}
+
+	Super::PinDefaultValueChanged(ChangedPin);
+}
+
+void UK2Node_CowConstructObjectAsync::PinConnectionListChanged(UEdGraphPin* ChangedPin)
+{
+	if (ChangedPin)
+	{
+		if (ChangedPin->PinName == SoftObjectClass)
+		{
+			OnSoftObjectClassChanged();
+		}
+		else if (ChangedPin == GetResultPin())
+		{
+			FCowCompilerUtilities::AutoWireCompletedPin(GetResultPin(), FindPinChecked(ObjectConstructed, EGPD_Output));
+		}
+	}
+
+	Super::PinConnectionListChanged(ChangedPin);
+}
+
+void UK2Node_CowConstructObjectAsync::OnSoftObjectClassChanged()
+{
+	UEdGraphPin* ObjectClassPin = FindPin(ObjectClass, EGPD_Input);
+
+	UClass* NewObjectClass = GetSoftClassToSpawn();
+
+	// (Re)register in UCowNodesEditorSubsystem to update exposed pins when they're added to the new Blueprint
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
+	{
+		CowSubsystem->RegisterNode(this, NewObjectClass, FSimpleDelegate::CreateUObject(this, &UK2Node_CowConstructObjectAsync::OnSoftObjectClassChanged));
+	}
+
+	ObjectClassToSpawn = NewObjectClass;
+
+	// Linked soft class pin already introduced hard-ref to its type, otherwise don't go further than the first native class
+	GetResultPin()->PinType.PinSubCategoryObject = IsSoftObjectClassConnected() ? ObjectClassToSpawn.Get() : FCowCompilerUtilities::GetFirstNativeClass(ObjectClassToSpawn.Get());
+
+	// Update Super's Class pin for Super to correctly populate exposed pins and reset it to avoid hard-ref
+	ObjectClassPin->DefaultObject = ObjectClassToSpawn;
+	OnClassPinChanged();
+	ObjectClassPin->DefaultObject = nullptr;
+
+	TryCreateOnObjectConstructedPin();
+}
+
+void UK2Node_CowConstructObjectAsync::UnbindFromBlueprintChange()
+{
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
+	{
+		CowSubsystem->UnregisterNode(this);
+	}
+}
+
+bool UK2Node_CowConstructObjectAsync::IsSpawnVarPin(UEdGraphPin* Pin) const
+{
+	return Super::IsSpawnVarPin(Pin) &&
+		Pin->PinName != SoftObjectClass &&
+		Pin->PinName != ObjectConstructed;
+}
+
+bool UK2Node_CowConstructObjectAsync::IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const
+{
+	// Fix auto-wiring uses Then instead of ObjectConstructed (see UK2Node_CowCreateWidgetAsync::IsConnectionDisallowed for details)
+	if (FCowCompilerUtilities::IsThenAutoWireDisallowed(GetThenPin(), GetResultPin(), MyPin, OtherPin))
+	{
+		return true;
+	}
+
+	return Super::IsConnectionDisallowed(MyPin, OtherPin, OutReason);
+}
+
+UClass* UK2Node_CowConstructObjectAsync::GetSoftClassToSpawn() const
+{
+	return FCowCompilerUtilities::GetClassFromSoftClassPin(GetSoftObjectPin());
+}
+
+bool UK2Node_CowConstructObjectAsync::IsSoftObjectClassConnected() const
+{
+	return !GetSoftObjectPin()->LinkedTo.IsEmpty();
+}
+
+#undef LOCTEXT_NAMESPACE
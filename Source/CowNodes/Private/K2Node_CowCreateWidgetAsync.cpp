@@ -5,6 +5,11 @@
 
 #include "BlueprintCompilationManager.h"
 #include "CowCompilerUtilities.h"
+#include "CowExposedPropertyCache.h"
+#include "CowNodesSettings.h"
+#include "CowCreateWidgetAsyncAction.h"
+#include "CowNodesEditorSubsystem.h"
+#include "K2Node_AsyncAction.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_LoadAsset.h"
 #include "KismetCompiler.h"
@@ -12,6 +17,7 @@
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "ProfilingDebugging/ScopedTimers.h"
 
 #define LOCTEXT_NAMESPACE "Cow"
 
@@ -22,107 +28,12 @@ UEdGraphPin* UK2Node_CowCreateWidgetAsync::GetSoftWidgetPin() const
 
 void UK2Node_CowCreateWidgetAsync::ValidateSpawnVarPins(const FKismetCompilerContext& CompilerContext) const
 {
-	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
-
-	auto DisplayNoteForPin = [&CompilerContext](UEdGraphPin* Pin)
-	{
-		CompilerContext.MessageLog.Note(*LOCTEXT("CowCreateWidgetAsync_DefaultValueNote", "@@ pin's default value is equal to base class's default value which may indicate an error.").ToString(), Pin);
-	};
-
-	// Blacklist for our internal pins
-	auto InternalPins = GetInternalPins();
-	
-	for (UEdGraphPin* Pin : Pins)
-	{
-		// We need to check only pins generated for Exposed vars
-		// + we only care if default value is edited, any linked pins are out of the validation context
-		//	 because their values could be different at runtime
-		if (Pin && Pin->Direction == EGPD_Input && Pin->LinkedTo.IsEmpty())
-		{
-			if (InternalPins.Find(Pin) != INDEX_NONE)
-			{
-				continue;
-			}
-			
-			FProperty* PropertyForPin = WidgetClassToSpawn->FindPropertyByName(Pin->PinName);
-			if (!PropertyForPin)
-			{
-				continue;
-			}
-			
-			FString DefaultValueErrorString = Schema->IsCurrentPinDefaultValid(Pin);
-			if (!DefaultValueErrorString.IsEmpty())
-			{
-				// Some types require a connection for assignment (e.g. arrays).
-				continue;
-			}
-			// We don't want to generate an assignment node unless the default value 
-			// differs from the value in the CDO:
-			FString DefaultValueAsString;
-			if (!FBlueprintCompilationManager::GetDefaultValue(WidgetClassToSpawn, PropertyForPin, DefaultValueAsString))
-			{
-				if (WidgetClassToSpawn->ClassDefaultObject)
-				{
-					FBlueprintEditorUtils::PropertyValueToString(PropertyForPin, (uint8*)WidgetClassToSpawn->ClassDefaultObject.Get(), DefaultValueAsString);
-				}
-			}
-
-			// First check the string representation of the default value
-			if (Schema->DoesDefaultValueMatch(*Pin, DefaultValueAsString))
-			{
-				DisplayNoteForPin(Pin);
-				continue;
-			}
-
-			FString UseDefaultValue;
-			TObjectPtr<UObject> UseDefaultObject = nullptr;
-			FText UseDefaultText;
-			constexpr bool bPreserveTextIdentity = true;
-
-			// Next check if the converted default value would be the same to handle cases like None for object pointers
-			Schema->GetPinDefaultValuesFromString(Pin->PinType, Pin->GetOwningNodeUnchecked(), DefaultValueAsString, UseDefaultValue, UseDefaultObject, UseDefaultText, bPreserveTextIdentity);
-			if (Pin->DefaultValue.Equals(UseDefaultValue, ESearchCase::CaseSensitive) && Pin->DefaultObject == UseDefaultObject && Pin->DefaultTextValue.IdenticalTo(UseDefaultText))
-			{
-				DisplayNoteForPin(Pin);
-				continue;
-			}
-		}
-	}
+	FCowCompilerUtilities::NoteSpawnVarPinsMatchingDefaults(CompilerContext, this, WidgetClassToSpawn, GetInternalPinNames());
 }
 
 bool UK2Node_CowCreateWidgetAsync::ValidateSpawnVarPinsNameConflicts(const FKismetCompilerContext& CompilerContext) const
 {
-	// If any exposed pins has conflicting name with internal pins it will cause problems
-	// Pins won't be shown
-	// Generation of assignments will be wrong
-	auto InternalPins = GetInternalPinNames();
-	check(WidgetClassToSpawn);
-
-	for (TFieldIterator<FProperty> PropertyIt(WidgetClassToSpawn, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
-	{
-		FProperty* Property = *PropertyIt;
-		const bool bIsDelegate = Property->IsA(FMulticastDelegateProperty::StaticClass());
-		const bool bIsExposedToSpawn = UEdGraphSchema_K2::IsPropertyExposedOnSpawn(Property);
-		const bool bIsSettableExternally = !Property->HasAnyPropertyFlags(CPF_DisableEditOnInstance);
-
-		if(	bIsExposedToSpawn &&
-			!Property->HasAnyPropertyFlags(CPF_Parm) && 
-			bIsSettableExternally &&
-			Property->HasAllPropertyFlags(CPF_BlueprintVisible) &&
-			!bIsDelegate &&
-			FBlueprintEditorUtils::PropertyStillExists(Property))
-		{
-			int32 Index = InternalPins.Find(Property->GetFName());
-			if (const bool bPropertyNameIsConflictingWithInternalPins = Index != INDEX_NONE)
-			{
-				CompilerContext.MessageLog.Error(*FString::Printf(TEXT("@@ property %s from type %s has conflicting name with internal pin %s"),
-					*Property->GetName(), *GetNameSafe(WidgetClassToSpawn), *InternalPins[Index].ToString()), this);
-				return false;
-			}
-		}
-	}
-
-	return true;
+	return FCowCompilerUtilities::ValidateSpawnVarPinsNameConflicts(CompilerContext, this, WidgetClassToSpawn, GetInternalPinNames());
 }
 
 FText UK2Node_CowCreateWidgetAsync::GetBaseNodeTitle() const
@@ -135,6 +46,12 @@ FText UK2Node_CowCreateWidgetAsync::GetNodeTitleFormat() const
 	return LOCTEXT("CreateWidget", "Cow Create {ClassName} Widget Async");
 }
 
+FText UK2Node_CowCreateWidgetAsync::GetTooltipText() const
+{
+	return LOCTEXT("CowCreateWidgetAsync_Tooltip", "Loads the soft widget class asynchronously and creates a widget of it, ExposeOnSpawn variables are assigned before WidgetCreated\n"
+		"Executions while the class is loading are ignored (same as LoadAsset), only one widget is created");
+}
+
 void UK2Node_CowCreateWidgetAsync::TryCreateOnWidgetCreatedPin()
 {
 	if (FindPin(WidgetCreated, EGPD_Output) == nullptr)
@@ -173,6 +90,17 @@ void UK2Node_CowCreateWidgetAsync::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+void UK2Node_CowCreateWidgetAsync::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Only baked into the generated code, no pins to reconstruct
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_CowCreateWidgetAsync, LoadPriority))
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
 void UK2Node_CowCreateWidgetAsync::AllocateDefaultPins()
 {
 	Super::AllocateDefaultPins();
@@ -193,6 +121,10 @@ void UK2Node_CowCreateWidgetAsync::AllocateDefaultPins()
 
 void UK2Node_CowCreateWidgetAsync::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
 {
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
 	// On purpose omitted Super::ExpandNode because it will duplicate a lot of ongoing logic
 	UK2Node_ConstructObjectFromClass::ExpandNode(CompilerContext, SourceGraph);
 	
@@ -209,7 +141,82 @@ void UK2Node_CowCreateWidgetAsync::ExpandNode(FKismetCompilerContext& CompilerCo
 		BreakAllNodeLinks();
 		return;
 	}
-	
+
+	UEdGraphPin* This_InputSoftRef = GetSoftWidgetPin();
+	if (!This_InputSoftRef->LinkedTo.IsEmpty())
+	{
+		// Notify user if he introduced hard-ref through the linked pin
+		FCowCompilerUtilities::NoteHardRefThroughSoftClassPin(CompilerContext, This_InputSoftRef);
+
+		// If we happen to connect SoftWidgetClass via Link to another pin (meaning at runtime the class may be different)
+		// Give a note for any default values that aren't changed from the base class
+		ValidateSpawnVarPins(CompilerContext);
+	}
+
+	if (UCowNodesSettings::UseCompactCodeGeneration())
+	{
+		ExpandNodeCompact(CompilerContext, SourceGraph);
+	}
+	else
+	{
+		if (LoadPriority != ECowLoadPriority::Gameplay)
+		{
+			CompilerContext.MessageLog.Note(*LOCTEXT("CowCreateWidgetAsync_LegacyPriority", "Load Priority of @@ is ignored, LoadAsset used by legacy code generation has no priority.").ToString(), this);
+		}
+		ExpandNodeLegacy(CompilerContext, SourceGraph);
+	}
+
+	BreakAllNodeLinks();
+}
+
+void UK2Node_CowCreateWidgetAsync::ExpandNodeCompact(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	// Graph for better understanding implementation details:
+	//
+	//                                    /> Then (Executed immediately after the action is activated)
+	// UCowCreateWidgetAsyncAction -------|
+	// (loads class and creates widget)   \> Completed -> Generate assignments via SetPropertyByName -> OnWidgetCompleted pin
+	//
+	// Compared to ExpandNodeLegacy there are no LoadAsset, casts and soft ref conversions in the graph (and so in the ubergraph bytecode)
+	// SoftWidgetClass pin type matches the action parameter so both linked and default values are simply moved
+
+	UK2Node_AsyncAction* CreateAction = CompilerContext.SpawnIntermediateNode<UK2Node_AsyncAction>(this, SourceGraph);
+	CreateAction->InitializeProxyFromFunction(UCowCreateWidgetAsyncAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowCreateWidgetAsyncAction, CowCreateWidgetAsync)));
+	CreateAction->AllocateDefaultPins();
+	FCowCompilerUtilities::SetNodeGuidPinDefault(CompilerContext, CreateAction, this);
+
+	UEdGraphPin* Action_InputWidgetClass = CreateAction->FindPinChecked(Action_InputWidgetClassName, EGPD_Input);
+	UEdGraphPin* Action_InputOwningPlayer = CreateAction->FindPinChecked(Create_InputOwningPlayer, EGPD_Input);
+	UEdGraphPin* Action_InputPriority = CreateAction->FindPinChecked(Action_InputPriorityName, EGPD_Input);
+	UEdGraphPin* Action_OutputCompleted = CreateAction->FindPinChecked(Action_OutputCompletedName, EGPD_Output);
+	UEdGraphPin* Action_OutputWidget = CreateAction->FindPinChecked(Action_OutputWidgetName, EGPD_Output);
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *CreateAction->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *CreateAction->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetSoftWidgetPin(), *Action_InputWidgetClass);
+
+	if (UEdGraphPin* This_InputWorldContextPin = GetWorldContextPin())
+	{
+		if (UEdGraphPin* Action_InputWorldContextPin = CreateAction->FindPin(Create_InputWorldContextObject, EGPD_Input))
+		{
+			CompilerContext.MovePinLinksToIntermediate(*This_InputWorldContextPin, *Action_InputWorldContextPin);
+		}
+	}
+	CompilerContext.MovePinLinksToIntermediate(*GetOwningPlayerPin(), *Action_InputOwningPlayer);
+	CompilerContext.GetSchema()->TrySetDefaultValue(*Action_InputPriority, StaticEnum<ECowLoadPriority>()->GetNameStringByValue(static_cast<int64>(LoadPriority)));
+
+	Action_OutputWidget->PinType = GetResultPin()->PinType; // (Type match required to connect pins)
+	CompilerContext.MovePinLinksToIntermediate(*GetResultPin(), *Action_OutputWidget);
+
+	//////////////////////////////////////////////////////////////////////////
+	// create 'set var' nodes
+	UEdGraphPin* LastThen = FCowCompilerUtilities::GenerateAssignmentNodes(CompilerContext, SourceGraph, CreateAction, Action_OutputCompleted, this, Action_OutputWidget, WidgetClassToSpawn, Action_InputWidgetClass);
+
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(WidgetCreated, EGPD_Output), *LastThen);
+}
+
+void UK2Node_CowCreateWidgetAsync::ExpandNodeLegacy(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
     // Graph for better understanding implementation details:
     //
     //             /> Then (Executed immediately after LoadAsset call)
@@ -257,23 +264,8 @@ void UK2Node_CowCreateWidgetAsync::ExpandNode(FKismetCompilerContext& CompilerCo
     //      Otherwise we cannot connect it to LoadAsset_Input
     if (!This_InputSoftRef->LinkedTo.IsEmpty())
     {
-	    // Notify user if he introduced hard-ref through the linked pin
-    	UEdGraphPin* SoftWidgetSourcePin = This_InputSoftRef->LinkedTo[0];
-    	if (UClass* SourceClass = Cast<UClass>(SoftWidgetSourcePin->PinType.PinSubCategoryObject.Get()))
-    	{
-    		if (!SourceClass->HasAnyClassFlags(CLASS_Native))
-    		{
-    			// Let's be honest - I won't localize it, so fuck this LOCTEXT macro :)
-    			CompilerContext.MessageLog.Note(*FString::Printf(TEXT("You introduced hard-ref to %s via @@ pin. Make sure it doesn't happened accidentally and you actually wanted it"), *SourceClass->GetName()), SoftWidgetSourcePin);
-    		}
-    	}
-    	
         UEdGraphPin* ConversationReturnPin = GenerateConvertToSoftObjectRef(CompilerContext, SourceGraph, This_InputSoftRef);
         ensureAlways(Schema->TryCreateConnection(ConversationReturnPin, LoadAsset_InputAsset));
-    	
-    	// If we happen to connect SoftWidgetClass via Link to another pin (meaning at runtime the class may be different)
-    	// Give a note for any default values that aren't changed from the base class
-    	ValidateSpawnVarPins(CompilerContext);
     }
     // b. We selected class directly using drop-down class picker
     //      The selected class is in Pin->DefaultValue and we can simply transfer the data
@@ -327,8 +319,6 @@ void UK2Node_CowCreateWidgetAsync::ExpandNode(FKismetCompilerContext& CompilerCo
 	
 	// Move 'then' connection from create widget node to the last 'then'
 	CompilerContext.MovePinLinksToIntermediate(*This_OutputOnWidgetCreated, *LastThen);
-	
-	BreakAllNodeLinks();
 }
 
 FText UK2Node_CowCreateWidgetAsync::GetNodeTitle(ENodeTitleType::Type TitleType) const
@@ -432,41 +422,20 @@ void UK2Node_CowCreateWidgetAsync::OnSoftWidgetClassChanged()
 
 	/**
 	 * When we change (or just check) selected WidgetClass we need to do several things:
-	 *  1. Unbind from previous Blueprint's OnChange event
-	 *  2. Bind to a new Blueprint's OnChange event (to update exposed pins when they added)
-	 *  3. Update Super::WidgetClassPin for Super to correctly populate exposed pins
+	 *  1. (Re)register in UCowNodesEditorSubsystem to update exposed pins when they're added to the new Blueprint
+	 *		Registration is no-op if we're already tracking the same Blueprint (e.g. serialized WidgetClassToSpawn after editor start)
+	 *  2. Update Super::WidgetClassPin for Super to correctly populate exposed pins
 	 */
-	UClass* OldWidgetClass = WidgetClassToSpawn;
+	UClass* NewWidgetClass = GetClassToSpawn();
 
-    UClass* NewWidgetClass = GetClassToSpawn();
-
-	// If we happen to start the editor but our node has Serialized WidgetClassToSpawn we need to bind to owning OnChanged 
-	const bool bBindedToOnChanged = OnWidgetBlueprintChangedHandle.IsValid();
-	const bool bRunForOnChangedBinding = NewWidgetClass && !bBindedToOnChanged;
-	if (bRunForOnChangedBinding || NewWidgetClass != OldWidgetClass)
+	// 1. (Re)register in UCowNodesEditorSubsystem
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
 	{
-		// 1. Unbind from previous Blueprint's OnChange event
-		UnbindFromBlueprintChange();
-
-		// 2. Bind to a new Blueprint's OnChange event (to update exposed pins when they added)
-		if (NewWidgetClass)
-		{
-			if (auto BlueprintClass = Cast<UBlueprintGeneratedClass>(NewWidgetClass))
-			{
-				if (auto Blueprint = Cast<UBlueprint>(BlueprintClass->ClassGeneratedBy))
-				{
-					WeakWidgetClassBlueprint = Blueprint;
-					OnWidgetBlueprintChangedHandle = Blueprint->OnChanged().AddWeakLambda(this, [this](class UBlueprint*)
-					{
-						OnSoftWidgetClassChanged();
-					});			
-				}
-			}
-		}
-
-		WidgetClassToSpawn = NewWidgetClass;
+		CowSubsystem->RegisterNode(this, NewWidgetClass, FSimpleDelegate::CreateUObject(this, &UK2Node_CowCreateWidgetAsync::OnSoftWidgetClassChanged));
 	}
 
+	WidgetClassToSpawn = NewWidgetClass;
+
     // Fix our return type
     //
     // If soft widget class pin connected to anything that means that our type is propagated
@@ -490,7 +459,7 @@ void UK2Node_CowCreateWidgetAsync::OnSoftWidgetClassChanged()
         ResultPin->PinType.PinSubCategoryObject = GetFirstNativeClass(WidgetClassToSpawn);
     }
 
-	// 3. Update Super::WidgetClassPin for Super to correctly populate exposed pins
+	// 2. Update Super::WidgetClassPin for Super to correctly populate exposed pins
 	WidgetClassPin->DefaultObject = WidgetClassToSpawn;
 
 	// Always try to regenerate 
@@ -505,11 +474,9 @@ void UK2Node_CowCreateWidgetAsync::OnSoftWidgetClassChanged()
 
 void UK2Node_CowCreateWidgetAsync::UnbindFromBlueprintChange()
 {
-	if (auto Blueprint = WeakWidgetClassBlueprint.Get())
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
 	{
-		Blueprint->OnChanged().Remove(OnWidgetBlueprintChangedHandle);
-		OnWidgetBlueprintChangedHandle.Reset();
-		WeakWidgetClassBlueprint.Reset();
+		CowSubsystem->UnregisterNode(this);
 	}
 }
 
@@ -549,43 +516,12 @@ bool UK2Node_CowCreateWidgetAsync::IsConnectionDisallowed(const UEdGraphPin* MyP
 
 bool UK2Node_CowCreateWidgetAsync::IsAnyInputExecPinsConnected(const TArray<UEdGraphPin*>& Pins, UEdGraphPin*& OutFirstUnconnectedPin)
 {
-    OutFirstUnconnectedPin = nullptr;
-
-    for (UEdGraphPin* Pin : Pins)
-    {
-        if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && Pin->Direction == EEdGraphPinDirection::EGPD_Input)
-        {
-            if (!Pin->LinkedTo.IsEmpty())
-            {
-                return true;
-            }
-            if (OutFirstUnconnectedPin == nullptr)
-            {
-                OutFirstUnconnectedPin = Pin;
-            }
-        }
-    }
-
-    return false;
+    return FCowCompilerUtilities::IsAnyInputExecPinsConnected(Pins, OutFirstUnconnectedPin);
 }
 
 UClass* UK2Node_CowCreateWidgetAsync::GetClassToSpawn() const
 {
-    UEdGraphPin* SoftWidgetClassPin = FindPinChecked(SoftWidgetClass, EGPD_Input);
-
-    // If SoftWidgetClassPin isn't connected to anything and not empty we should use Path written in DefaultValue
-	if (!SoftWidgetClassPin->DefaultValue.IsEmpty() && SoftWidgetClassPin->LinkedTo.Num() == 0)
-	{
-        FSoftObjectPath SoftWidget = SoftWidgetClassPin->DefaultValue;
-        return Cast<UClass>(SoftWidget.TryLoad());
-	}
-	else if (SoftWidgetClassPin->LinkedTo.Num())
-	{
-		UEdGraphPin* ClassSource = SoftWidgetClassPin->LinkedTo[0];
-		return Cast<UClass>(ClassSource->PinType.PinSubCategoryObject.Get());
-	}
-    
-    return nullptr;
+    return FCowCompilerUtilities::GetClassFromSoftClassPin(GetSoftWidgetPin());
 }
 
 UEdGraphPin* UK2Node_CowCreateWidgetAsync::GenerateConvertToSoftObjectRef(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* SoftClassPin)
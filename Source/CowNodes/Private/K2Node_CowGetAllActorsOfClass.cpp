@@ -10,14 +10,84 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "BlueprintNodeSpawner.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "Blueprint/BlueprintSupport.h"
+#include "EdGraphUtilities.h"
+#include "KismetCompilerMisc.h"
+#include "KismetCompiledFunctionContext.h"
+#include "ProfilingDebugging/ScopedTimers.h"
 
 // Cow
 #include "CowFunctionLibrary.h"
+#include "CowNativeClassCache.h"
+#include "CowNodesSettings.h"
 
 #define LOCTEXT_NAMESPACE "Cow"
 
+/**
+ * Compact code generation for UK2Node_CowGetAllActorsOfClass
+ *
+ * Instead of spawning intermediate CallFunction node (which has to be pruned, scheduled and compiled like any user node)
+ * we emit single KCST_CallFunction statement straight from the node pins
+ */
+class FKCHandler_CowGetAllActorsOfClass : public FNodeHandlingFunctor
+{
+public:
+	FKCHandler_CowGetAllActorsOfClass(FKismetCompilerContext& InCompilerContext)
+		: FNodeHandlingFunctor(InCompilerContext)
+	{
+	}
+
+	virtual void RegisterNets(FKismetFunctionContext& Context, UEdGraphNode* Node) override
+	{
+		FNodeHandlingFunctor::RegisterNets(Context, Node);
+
+		// Node has no pin for NodeGuid parameter, GUID is baked as a literal
+		NodeGuidTerms.Add(Node, FCowCompilerUtilities::CreateNodeGuidLiteral(Context, Node));
+	}
+
+	virtual void RegisterNet(FKismetFunctionContext& Context, UEdGraphPin* Net) override
+	{
+		// Unlinked inputs are registered as literals by FNodeHandlingFunctor::RegisterNets, so we end up here only for the output
+		FBPTerminal* Term = Context.CreateLocalTerminalFromPinAutoChooseScope(Net, Context.NetNameMap->MakeValidName(Net));
+		Context.NetMap.Add(Net, Term);
+	}
+
+	virtual void Compile(FKismetFunctionContext& Context, UEdGraphNode* Node) override
+	{
+		UK2Node_CowGetAllActorsOfClass* CowNode = CastChecked<UK2Node_CowGetAllActorsOfClass>(Node);
+		UFunction* Function = CowNode->GetTargetFunction();
+		check(Function);
+
+		FBlueprintCompiledStatement& CallStatement = Context.AppendStatementForNode(Node);
+		CallStatement.Type = KCST_CallFunction;
+		CallStatement.FunctionToCall = Function;
+		// Static library function, no context (same as FKCHandler_CallFunction does for functions without self pin)
+		CallStatement.FunctionContext = nullptr;
+
+		for (TFieldIterator<FProperty> ParamIt(Function); ParamIt && ParamIt->HasAnyPropertyFlags(CPF_Parm); ++ParamIt)
+		{
+			if (ParamIt->GetFName() == FCowCompilerUtilities::NodeGuidParamName)
+			{
+				CallStatement.RHS.Add(NodeGuidTerms.FindChecked(Node));
+				continue;
+			}
+
+			UEdGraphPin* Pin = CowNode->FindPin(ParamIt->GetFName());
+			FBPTerminal** Term = Pin ? Context.NetMap.Find(FEdGraphUtilities::GetNetFromPin(Pin)) : nullptr;
+			if (!Term)
+			{
+				CompilerContext.MessageLog.Error(*FString::Printf(TEXT("@@ failed to resolve term for %s parameter"), *ParamIt->GetName()), Node);
+				return;
+			}
+			CallStatement.RHS.Add(*Term);
+		}
+
+		GenerateSimpleThenGoto(Context, *Node);
+	}
+
+private:
+	TMap<UEdGraphNode*, FBPTerminal*> NodeGuidTerms;
+};
+
 void UK2Node_CowGetAllActorsOfClass::PostLoad()
 {
 	Super::PostLoad();
@@ -47,8 +117,8 @@ void UK2Node_CowGetAllActorsOfClass::AllocateDefaultPins()
 
 	FEdGraphPinType ActorClassPinType;
 	ActorClassPinType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
-	ActorClassPinType.PinSubCategoryObject = AActor::StaticClass();
-	CreatePin(EGPD_Input, ActorClassPinType, ActorClassName);
+	ActorClassPinType.PinSubCategoryObject = GetBaseClass();
+	CreatePin(EGPD_Input, ActorClassPinType, GetClassPinName());
 
 	FEdGraphPinType OutActorsPinType;
 	OutActorsPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
@@ -56,14 +126,14 @@ void UK2Node_CowGetAllActorsOfClass::AllocateDefaultPins()
 	{
 		OutActorsPinType.ContainerType = EPinContainerType::Array;
 	}
-	OutActorsPinType.PinSubCategoryObject = AActor::StaticClass();
+	OutActorsPinType.PinSubCategoryObject = GetBaseClass();
 	const FName OutActorPinName = bOutputAsArray ? OutActorsName : OutActorName;
 	CreatePin(EGPD_Output, OutActorsPinType, OutActorPinName);
 }
 
 void UK2Node_CowGetAllActorsOfClass::PinDefaultValueChanged(UEdGraphPin* ChangedPin)
 {
-	if (ChangedPin == FindPinChecked(ActorClassName, EGPD_Input))
+	if (ChangedPin == FindPinChecked(GetClassPinName(), EGPD_Input))
 	{
 		OnActorClassChanged();
 	}
@@ -71,7 +141,7 @@ void UK2Node_CowGetAllActorsOfClass::PinDefaultValueChanged(UEdGraphPin* Changed
 
 void UK2Node_CowGetAllActorsOfClass::PinConnectionListChanged(UEdGraphPin* ChangedPin)
 {
-	if (ChangedPin == FindPinChecked(ActorClassName, EGPD_Input))
+	if (ChangedPin == FindPinChecked(GetClassPinName(), EGPD_Input))
 	{
 		OnActorClassChanged();
 	}
@@ -79,30 +149,43 @@ void UK2Node_CowGetAllActorsOfClass::PinConnectionListChanged(UEdGraphPin* Chang
 
 void UK2Node_CowGetAllActorsOfClass::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
 {
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
 	if (GetNativeClassFromInput() == nullptr)
 	{
-		CompilerContext.MessageLog.Error(*LOCTEXT("CowGetAllActorsOfClass_Error", "Cow Get All Actors Of Class node @@ must have a class specified!").ToString(), this);
+		CompilerContext.MessageLog.Error(*FText::Format(LOCTEXT("CowGetAllActorsOfClass_Error", "{0} node @@ must have a class specified!"), GetNodeTitle(ENodeTitleType::FullTitle)).ToString(), this);
 		BreakAllNodeLinks();
 		return;
 	}
 
-	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+	// Node is compiled as is by FKCHandler_CowGetAllActorsOfClass
+	if (UCowNodesSettings::UseCompactCodeGeneration())
+	{
+		return;
+	}
+
 	UK2Node_CallFunction* Call_GetAllActorsOfClass = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	const FName GetFunctionName = bOutputAsArray ? GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetAllActorsOfClass) 
-												 : GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetActorOfClass);
-	Call_GetAllActorsOfClass->FunctionReference.SetExternalMember(GetFunctionName, UCowFunctionLibrary::StaticClass());
+	Call_GetAllActorsOfClass->SetFromFunction(GetTargetFunction());
 	Call_GetAllActorsOfClass->AllocateDefaultPins();
+	FCowCompilerUtilities::SetNodeGuidPinDefault(CompilerContext, Call_GetAllActorsOfClass, this);
 
 	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), 
 											   *Call_GetAllActorsOfClass->GetExecPin());
 	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), 
 											   *Call_GetAllActorsOfClass->GetThenPin());
-	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(WorldContextObjectName, EGPD_Input),
-											   *Call_GetAllActorsOfClass->FindPinChecked(WorldContextObjectName, EGPD_Input));
-	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ActorClassName, EGPD_Input), 
-											   *Call_GetAllActorsOfClass->FindPinChecked(ActorClassName, EGPD_Input));
+	// WorldContextObject, class and whatever inputs derived queries have
+	for (UEdGraphPin* Pin : Pins)
+	{
+		if (Pin->Direction == EGPD_Input && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+		{
+			CompilerContext.MovePinLinksToIntermediate(*Pin, 
+													   *Call_GetAllActorsOfClass->FindPinChecked(Pin->PinName, EGPD_Input));
+		}
+	}
 
 	UEdGraphPin* This_OutActorsPin = FindPinChecked(GetOutPinName(), EGPD_Output);
 	UEdGraphPin* Output_OutActorsPin = Call_GetAllActorsOfClass->FindPinChecked(GetOutPinName(), EGPD_Output);
@@ -113,6 +196,11 @@ void UK2Node_CowGetAllActorsOfClass::ExpandNode(FKismetCompilerContext& Compiler
 	BreakAllNodeLinks();
 }
 
+FNodeHandlingFunctor* UK2Node_CowGetAllActorsOfClass::CreateNodeHandler(FKismetCompilerContext& CompilerContext) const
+{
+	return UCowNodesSettings::UseCompactCodeGeneration() ? new FKCHandler_CowGetAllActorsOfClass(CompilerContext) : nullptr;
+}
+
 FText UK2Node_CowGetAllActorsOfClass::GetMenuCategory() const
 {
 	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::Utilities);
@@ -143,6 +231,11 @@ void UK2Node_CowGetAllActorsOfClass::GetMenuActions(FBlueprintActionDatabaseRegi
 
 		ActionRegistrar.AddBlueprintAction(ActionKey, DefaultNodeSpawner);
 
+		if (!SupportsSingleOutput())
+		{
+			return;
+		}
+
 		// Separate registration for CowGetActorOfClass version
 		auto PostSpawnSetupLambda = [](UEdGraphNode* InNewNode, bool bIsTemplateNode)
 		{
@@ -161,6 +254,11 @@ void UK2Node_CowGetAllActorsOfClass::GetNodeContextMenuActions(UToolMenu* Menu,
 {
 	Super::GetNodeContextMenuActions(Menu, Context);
 
+	if (!SupportsSingleOutput())
+	{
+		return;
+	}
+
 	FToolMenuSection& Section = Menu->AddSection("K2Node_CowGetAllActorsOfClass", LOCTEXT("FunctionHeader", "Function"));
 
 	Section.AddMenuEntry(
@@ -178,38 +276,13 @@ void UK2Node_CowGetAllActorsOfClass::GetNodeContextMenuActions(UToolMenu* Menu,
 
 UClass* UK2Node_CowGetAllActorsOfClass::GetNativeClassFromInput() const
 {
-    UEdGraphPin* ActorClassPin = FindPinChecked(ActorClassName, EGPD_Input);
+    UEdGraphPin* ActorClassPin = FindPinChecked(GetClassPinName(), EGPD_Input);
 
     // If ActorClassPin isn't connected to anything and not empty we should use Path written in DefaultValue
 	if (!ActorClassPin->DefaultValue.IsEmpty() && ActorClassPin->LinkedTo.Num() == 0)
 	{
-        FSoftObjectPath SoftActorClass = ActorClassPin->DefaultValue;
-
-		// If class is blueprint try to get native parent from metadata to avoid loading class here
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-		FAssetData AssetData;
-		if (AssetRegistryModule.Get().TryGetAssetByObjectPath(SoftActorClass, AssetData) == UE::AssetRegistry::EExists::Exists)
-		{
-			UClass* NativeParentClass = nullptr;
-			FString ParentClassName;
-			if(!AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassName))
-			{
-				// By the looks of it we shouldn't rely on it but all places that use NativeParentClassPath do, so let's be safe
-				AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassName);
-			}
-			if(!ParentClassName.IsEmpty())
-			{
-				UObject* Outer = nullptr;
-				ResolveName(Outer, ParentClassName, false, false);
-				NativeParentClass = FindObject<UClass>(Outer, *ParentClassName);
-			}
-			return NativeParentClass;
-		}
-		else
-		{
-			UClass* NativeClass = FindObject<UClass>(SoftActorClass.GetAssetPath(), true);
-			return NativeClass;
-		}
+		// Asset registry lookup is cached and shared between all nodes (see FCowNativeClassCache)
+		return FCowNativeClassCache::Get().FindNativeClass(FSoftObjectPath(ActorClassPin->DefaultValue));
 	}
 	else if (ActorClassPin->LinkedTo.Num())
 	{
@@ -225,8 +298,6 @@ UClass* UK2Node_CowGetAllActorsOfClass::GetNativeClassFromInput() const
 
 void UK2Node_CowGetAllActorsOfClass::OnActorClassChanged()
 {
-	UEdGraphPin* ActorClassPin = FindPinChecked(ActorClassName, EGPD_Input);
-
     // Fix our return type
     UEdGraphPin* OutActorsPin = FindPinChecked(GetOutPinName(), EGPD_Output);
 	OutActorsPin->PinType.PinSubCategoryObject = GetNativeClassFromInput();
@@ -250,9 +321,21 @@ const FText UK2Node_CowGetAllActorsOfClass::GetConvertContextActionName(const bo
 	return InOutputAsArray ? LOCTEXT("ConvertNodeToSingle", "Convert To Single Actor") : LOCTEXT("ConvertNodeToMulti", "Convert Get To All Actors");
 }
 
-const FName UK2Node_CowGetAllActorsOfClass::GetOutPinName() const
+FName UK2Node_CowGetAllActorsOfClass::GetOutPinName() const
 {
 	return bOutputAsArray ? OutActorsName : OutActorName;
 }
 
+UClass* UK2Node_CowGetAllActorsOfClass::GetBaseClass() const
+{
+	return AActor::StaticClass();
+}
+
+UFunction* UK2Node_CowGetAllActorsOfClass::GetTargetFunction() const
+{
+	const FName FunctionName = bOutputAsArray ? GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetAllActorsOfClass) 
+											  : GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetActorOfClass);
+	return UCowFunctionLibrary::StaticClass()->FindFunctionByName(FunctionName);
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowGetAllActorsOfClassInShape.h"
+
+// Cow
+#include "CowFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowGetAllActorsOfClassInShape::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowGetAllActorsOfClassInShapeNodeTitle", "Cow Get All Actors Of Class In Shape");
+}
+
+FText UK2Node_CowGetAllActorsOfClassInShape::GetTooltipText() const
+{
+	return LOCTEXT("CowGetAllActorsOfClassInShapeTooltip", "Finds all actors of the class inside the shape. Sphere, box and cone test actor location, frustum tests actor bounds against the camera view of Viewer (first local player if not set). Locations are updated once per frame");
+}
+
+void UK2Node_CowGetAllActorsOfClassInShape::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	UEdGraphPin* ShapePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, FCowQueryShape::StaticStruct(), ShapeName);
+	// Unlinked pin is passed as a literal (compact code generation too), so it needs a default
+	GetDefault<UEdGraphSchema_K2>()->SetPinAutogeneratedDefaultValueBasedOnType(ShapePin);
+}
+
+UFunction* UK2Node_CowGetAllActorsOfClassInShape::GetTargetFunction() const
+{
+	return UCowFunctionLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetAllActorsOfClassInShape));
+}
+
+#undef LOCTEXT_NAMESPACE
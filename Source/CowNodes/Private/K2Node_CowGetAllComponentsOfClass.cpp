@@ -0,0 +1,33 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowGetAllComponentsOfClass.h"
+
+// Engine
+#include "Components/ActorComponent.h"
+
+// Cow
+#include "CowFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowGetAllComponentsOfClass::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowGetAllComponentsOfClassNodeTitle", "Cow Get All Components Of Class");
+}
+
+FText UK2Node_CowGetAllComponentsOfClass::GetTooltipText() const
+{
+	return LOCTEXT("CowGetAllComponentsOfClassTooltip", "Finds all registered components of the class in the world. Cost depends on the number of components of the class, not on the number of actors");
+}
+
+UClass* UK2Node_CowGetAllComponentsOfClass::GetBaseClass() const
+{
+	return UActorComponent::StaticClass();
+}
+
+UFunction* UK2Node_CowGetAllComponentsOfClass::GetTargetFunction() const
+{
+	return UCowFunctionLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetAllComponentsOfClass));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowGetAllWidgetsOfClass.h"
+
+// Engine
+#include "Blueprint/UserWidget.h"
+
+// Cow
+#include "CowFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowGetAllWidgetsOfClass::GetMenuCategory() const
+{
+	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::UserInterface);
+}
+
+FText UK2Node_CowGetAllWidgetsOfClass::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowGetAllWidgetsOfClassNodeTitle", "Cow Get All Widgets Of Class");
+}
+
+FText UK2Node_CowGetAllWidgetsOfClass::GetTooltipText() const
+{
+	return LOCTEXT("CowGetAllWidgetsOfClassTooltip", "Finds all widgets of the class in the world. If TopLevelOnly is checked only widgets added to the viewport are returned");
+}
+
+void UK2Node_CowGetAllWidgetsOfClass::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	UEdGraphPin* TopLevelOnlyPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Boolean, TopLevelOnlyName);
+	// Same default as the stock node
+	GetDefault<UEdGraphSchema_K2>()->SetPinAutogeneratedDefaultValue(TopLevelOnlyPin, TEXT("true"));
+}
+
+UClass* UK2Node_CowGetAllWidgetsOfClass::GetBaseClass() const
+{
+	return UUserWidget::StaticClass();
+}
+
+UFunction* UK2Node_CowGetAllWidgetsOfClass::GetTargetFunction() const
+{
+	return UCowFunctionLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowGetAllWidgetsOfClass));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,211 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowLoadAssets.h"
+
+// Engine
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "K2Node_AsyncAction.h"
+#include "KismetCompiler.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+// Cow
+#include "CowCompilerUtilities.h"
+#include "CowLoadAssetsAsyncAction.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowLoadAssets::GetMenuCategory() const
+{
+	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::Utilities);
+}
+
+FText UK2Node_CowLoadAssets::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowLoadAssetsNodeTitle", "Cow Load Assets");
+}
+
+FText UK2Node_CowLoadAssets::GetTooltipText() const
+{
+	return LOCTEXT("CowLoadAssetsTooltip", "Loads all soft references with a single request and returns loaded objects in the same order");
+}
+
+FName UK2Node_CowLoadAssets::GetCornerIcon() const
+{
+	return TEXT("Graph.Latent.LatentIcon");
+}
+
+void UK2Node_CowLoadAssets::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	// Registered under the node's class (see UK2Node_CowGetAllActorsOfClass::GetMenuActions)
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+bool UK2Node_CowLoadAssets::IsCompatibleWithGraph(const UEdGraph* TargetGraph) const
+{
+	// Can only place events in ubergraphs and macros (other code will help prevent macros with latents from ending up in functions)
+	EGraphType GraphType = TargetGraph->GetSchema()->GetGraphType(TargetGraph);
+	const bool bIsCompatible = GraphType == EGraphType::GT_Ubergraph || GraphType == EGraphType::GT_Macro;
+	return bIsCompatible && Super::IsCompatibleWithGraph(TargetGraph);
+}
+
+bool UK2Node_CowLoadAssets::IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const
+{
+	if (MyPin->PinName == AssetsName && !IsSoftReferenceArray(OtherPin->PinType))
+	{
+		OutReason = LOCTEXT("CowLoadAssets_WrongType", "Only arrays of soft object or soft class references can be loaded").ToString();
+		return true;
+	}
+
+	return Super::IsConnectionDisallowed(MyPin, OtherPin, OutReason);
+}
+
+void UK2Node_CowLoadAssets::AllocateDefaultPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+
+	UEdGraphNode::FCreatePinParams ArrayPinParams;
+	ArrayPinParams.ContainerType = EPinContainerType::Array;
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Wildcard, AssetsName, ArrayPinParams);
+
+	UEdGraphPin* PriorityPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Int, PriorityName);
+	PriorityPin->DefaultValue = TEXT("0");
+
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, OnProgressName);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Float, ProgressName);
+
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, CompletedName);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Wildcard, LoadedName, ArrayPinParams);
+
+	Super::AllocateDefaultPins();
+}
+
+void UK2Node_CowLoadAssets::PostReconstructNode()
+{
+	Super::PostReconstructNode();
+
+	RefreshPinTypes();
+}
+
+void UK2Node_CowLoadAssets::PinConnectionListChanged(UEdGraphPin* ChangedPin)
+{
+	if (ChangedPin && ChangedPin->PinName == AssetsName)
+	{
+		RefreshPinTypes();
+	}
+
+	Super::PinConnectionListChanged(ChangedPin);
+}
+
+void UK2Node_CowLoadAssets::RefreshPinTypes()
+{
+	UEdGraphPin* AssetsPin = FindPinChecked(AssetsName, EGPD_Input);
+	UEdGraphPin* LoadedPin = FindPinChecked(LoadedName, EGPD_Output);
+
+	const FEdGraphPinType OldLoadedType = LoadedPin->PinType;
+
+	if (!AssetsPin->LinkedTo.IsEmpty() && IsSoftReferenceArray(AssetsPin->LinkedTo[0]->PinType))
+	{
+		const FEdGraphPinType& SourceType = AssetsPin->LinkedTo[0]->PinType;
+		AssetsPin->PinType = SourceType;
+		AssetsPin->PinType.bIsReference = false;
+		AssetsPin->PinType.bIsConst = false;
+
+		// Same as return pins of other Cow nodes, even though the linked pin already has hard-ref to its element type
+		// Loaded doesn't go further than the first native class, so it can be passed around without spreading the reference
+		LoadedPin->PinType.PinCategory = SourceType.PinCategory == UEdGraphSchema_K2::PC_SoftClass ? UEdGraphSchema_K2::PC_Class : UEdGraphSchema_K2::PC_Object;
+		LoadedPin->PinType.PinSubCategory = NAME_None;
+		LoadedPin->PinType.PinSubCategoryObject = FCowCompilerUtilities::GetFirstNativeClass(Cast<UClass>(SourceType.PinSubCategoryObject.Get()));
+	}
+	else
+	{
+		AssetsPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+		AssetsPin->PinType.PinSubCategory = NAME_None;
+		AssetsPin->PinType.PinSubCategoryObject = nullptr;
+
+		LoadedPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+		LoadedPin->PinType.PinSubCategory = NAME_None;
+		LoadedPin->PinType.PinSubCategoryObject = nullptr;
+	}
+	AssetsPin->PinType.ContainerType = EPinContainerType::Array;
+	LoadedPin->PinType.ContainerType = EPinContainerType::Array;
+
+	if (LoadedPin->PinType != OldLoadedType)
+	{
+		UEdGraphSchema_K2::ValidateExistingConnections(LoadedPin);
+		if (UEdGraph* Graph = GetGraph())
+		{
+			Graph->NotifyGraphChanged();
+		}
+	}
+}
+
+bool UK2Node_CowLoadAssets::IsLoadingClasses() const
+{
+	return FindPinChecked(AssetsName, EGPD_Input)->PinType.PinCategory == UEdGraphSchema_K2::PC_SoftClass;
+}
+
+bool UK2Node_CowLoadAssets::IsSoftReferenceArray(const FEdGraphPinType& PinType)
+{
+	return PinType.IsArray() && (PinType.PinCategory == UEdGraphSchema_K2::PC_SoftObject || PinType.PinCategory == UEdGraphSchema_K2::PC_SoftClass);
+}
+
+void UK2Node_CowLoadAssets::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	UEdGraphPin* This_InputAssets = FindPinChecked(AssetsName, EGPD_Input);
+	if (This_InputAssets->LinkedTo.IsEmpty() || !IsSoftReferenceArray(This_InputAssets->PinType))
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("CowLoadAssets_Error", "Cow Load Assets node @@ must have Assets connected to an array of soft object or soft class references!").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	// Graph for better understanding implementation details:
+	//
+	//                                              /> Then (Executed immediately after the request is issued)
+	// UCowLoadAssetsAsyncAction/UCowLoadClasses --|-> OnProgress (Progress)
+	// (single streamable request)                  \> Completed (Objects/Classes -> Loaded)
+
+	const bool bLoadingClasses = IsLoadingClasses();
+	UFunction* Factory = bLoadingClasses
+		? UCowLoadClassesAsyncAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowLoadClassesAsyncAction, CowLoadClasses))
+		: UCowLoadAssetsAsyncAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowLoadAssetsAsyncAction, CowLoadAssets));
+
+	UK2Node_AsyncAction* LoadAction = CompilerContext.SpawnIntermediateNode<UK2Node_AsyncAction>(this, SourceGraph);
+	LoadAction->InitializeProxyFromFunction(Factory);
+	LoadAction->AllocateDefaultPins();
+	FCowCompilerUtilities::SetNodeGuidPinDefault(CompilerContext, LoadAction, this);
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *LoadAction->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *LoadAction->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*This_InputAssets, *LoadAction->FindPinChecked(bLoadingClasses ? Action_InputSoftClassesName : Action_InputAssetsName, EGPD_Input));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(PriorityName, EGPD_Input), *LoadAction->FindPinChecked(PriorityName, EGPD_Input));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(OnProgressName, EGPD_Output), *LoadAction->FindPinChecked(OnProgressName, EGPD_Output));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ProgressName, EGPD_Output), *LoadAction->FindPinChecked(ProgressName, EGPD_Output));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(CompletedName, EGPD_Output), *LoadAction->FindPinChecked(CompletedName, EGPD_Output));
+
+	UEdGraphPin* This_OutputLoaded = FindPinChecked(LoadedName, EGPD_Output);
+	UEdGraphPin* Action_OutputLoaded = LoadAction->FindPinChecked(bLoadingClasses ? Action_OutputClassesName : Action_OutputObjectsName, EGPD_Output);
+	Action_OutputLoaded->PinType = This_OutputLoaded->PinType; // (Type match required to connect pins)
+	CompilerContext.MovePinLinksToIntermediate(*This_OutputLoaded, *Action_OutputLoaded);
+
+	BreakAllNodeLinks();
+}
+
+#undef LOCTEXT_NAMESPACE
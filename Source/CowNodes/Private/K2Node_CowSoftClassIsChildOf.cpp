@@ -0,0 +1,87 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowSoftClassIsChildOf.h"
+
+// Engine
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "K2Node_CallFunction.h"
+#include "KismetCompiler.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+// Cow
+#include "CowCompilerUtilities.h"
+#include "CowFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowSoftClassIsChildOf::GetMenuCategory() const
+{
+	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::Utilities);
+}
+
+FText UK2Node_CowSoftClassIsChildOf::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowSoftClassIsChildOfNodeTitle", "Cow Soft Class Is Child Of");
+}
+
+FText UK2Node_CowSoftClassIsChildOf::GetTooltipText() const
+{
+	return LOCTEXT("CowSoftClassIsChildOfTooltip", "Returns true if Class is ParentClass or its child. Neither class is loaded, parents of unloaded Blueprints are read from asset registry");
+}
+
+void UK2Node_CowSoftClassIsChildOf::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	// Registered under the node's class (see UK2Node_CowGetAllActorsOfClass::GetMenuActions)
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+void UK2Node_CowSoftClassIsChildOf::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	FEdGraphPinType SoftClassPinType;
+	SoftClassPinType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
+	SoftClassPinType.PinSubCategoryObject = UObject::StaticClass();
+	CreatePin(EGPD_Input, SoftClassPinType, ClassName);
+	CreatePin(EGPD_Input, SoftClassPinType, ParentClassName);
+
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, UEdGraphSchema_K2::PN_ReturnValue);
+}
+
+void UK2Node_CowSoftClassIsChildOf::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	UEdGraphPin* This_ParentClassPin = FindPinChecked(ParentClassName, EGPD_Input);
+	if (This_ParentClassPin->LinkedTo.IsEmpty() && This_ParentClassPin->DefaultValue.IsEmpty())
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("CowSoftClassIsChildOf_Error", "Cow Soft Class Is Child Of node @@ must have a parent class specified!").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	UK2Node_CallFunction* Call_IsChildOf = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	Call_IsChildOf->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowSoftClassIsChildOf), UCowFunctionLibrary::StaticClass());
+	Call_IsChildOf->AllocateDefaultPins();
+
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ClassName, EGPD_Input), *Call_IsChildOf->FindPinChecked(ClassName, EGPD_Input));
+	CompilerContext.MovePinLinksToIntermediate(*This_ParentClassPin, *Call_IsChildOf->FindPinChecked(ParentClassName, EGPD_Input));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue, EGPD_Output), *Call_IsChildOf->GetReturnValuePin());
+
+	BreakAllNodeLinks();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,314 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowSpawnActorAsync.h"
+
+#include "CowCompilerUtilities.h"
+#include "CowNodesEditorSubsystem.h"
+#include "CowSpawnActorAsyncAction.h"
+#include "K2Node_AsyncAction.h"
+#include "KismetCompiler.h"
+#include "GameFramework/Actor.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+UEdGraphPin* UK2Node_CowSpawnActorAsync::GetSoftActorPin() const
+{
+	return FindPinChecked(SoftActorClass, EGPD_Input);
+}
+
+FText UK2Node_CowSpawnActorAsync::GetBaseNodeTitle() const
+{
+	return LOCTEXT("CowSpawnActorAsync_BaseTitle", "Cow Spawn Actor Async");
+}
+
+FText UK2Node_CowSpawnActorAsync::GetNodeTitleFormat() const
+{
+	return LOCTEXT("CowSpawnActorAsync_TitleFormat", "Cow Spawn {ClassName} Async");
+}
+
+FText UK2Node_CowSpawnActorAsync::GetTooltipText() const
+{
+	return LOCTEXT("CowSpawnActorAsync_Tooltip", "Loads the soft actor class asynchronously and spawns an actor of it, ExposeOnSpawn variables are assigned before construction script");
+}
+
+void UK2Node_CowSpawnActorAsync::TryCreateAsyncOutputPins()
+{
+	if (FindPin(ActorSpawned, EGPD_Output) == nullptr)
+	{
+		FEdGraphPinType PinType;
+		PinType.PinCategory = UEdGraphSchema_K2::PC_Exec;
+		CreatePin(EGPD_Output, PinType, ActorSpawned, 2);
+	}
+}
+
+void UK2Node_CowSpawnActorAsync::PostReconstructNode()
+{
+	Super::PostReconstructNode();
+
+	// Same as UK2Node_CowCreateWidgetAsync: refresh doesn't call any events we use to fixup the state
+	OnSoftActorClassChanged();
+}
+
+void UK2Node_CowSpawnActorAsync::PostLoad()
+{
+	// We could have changed dependant class while blueprint with the node was closed, therefore we missed OnChanged event
+	if (HasValidBlueprint())
+	{
+		OnSoftActorClassChanged();
+	}
+
+	Super::PostLoad();
+}
+
+void UK2Node_CowSpawnActorAsync::BeginDestroy()
+{
+	UnbindFromBlueprintChange();
+
+	Super::BeginDestroy();
+}
+
+void UK2Node_CowSpawnActorAsync::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	// Hide "Class" pin from UK2Node_SpawnActorFromClass
+	// It is used to reuse parent functionality to spawn ExposedOnSpawn pins from selected class
+	UEdGraphPin* ClassPin = FindPin(ActorClass, EGPD_Input);
+	check(ClassPin);
+	ClassPin->bHidden = true;
+
+	FEdGraphPinType SoftClassType;
+	SoftClassType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
+	SoftClassType.PinSubCategoryObject = AActor::StaticClass();
+	CreatePin(EGPD_Input, SoftClassType, SoftActorClass);
+
+	TryCreateAsyncOutputPins();
+}
+
+void UK2Node_CowSpawnActorAsync::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	// On purpose omitted Super::ExpandNode, it expands to BeginDeferredActorSpawnFromClass with the hard class
+	UK2Node_ConstructObjectFromClass::ExpandNode(CompilerContext, SourceGraph);
+
+	if (!ValidateExpansion(CompilerContext))
+	{
+		return;
+	}
+
+	// Graph for better understanding implementation details:
+	//
+	//                                   /> Then (Executed immediately after the action is activated)
+	// UCowSpawnActorAsyncAction -------|-> BeginSpawn -> Generate assignments via SetPropertyByName (deferred actor, before construction script)
+	// (loads class, spawns deferred)   \> Completed -> ActorSpawned pin (FinishSpawningActor is called by the action)
+	//
+	// BeginSpawn and Completed share the Actor output pin (UK2Node_BaseAsyncTask creates one pin per delegate parameter name)
+
+	UK2Node_AsyncAction* SpawnAction = ExpandSpawnAction(CompilerContext, SourceGraph, UCowSpawnActorAsyncAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowSpawnActorAsyncAction, CowSpawnActorAsync)));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ActorSpawned, EGPD_Output), *SpawnAction->FindPinChecked(Action_OutputCompletedName, EGPD_Output));
+
+	BreakAllNodeLinks();
+}
+
+bool UK2Node_CowSpawnActorAsync::ValidateExpansion(FKismetCompilerContext& CompilerContext)
+{
+	if (ActorClassToSpawn == nullptr)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("CowSpawnActorAsync_Error", "Spawn Actor Async node @@ must have a class specified.").ToString(), this);
+		BreakAllNodeLinks();
+		return false;
+	}
+
+	if (!FCowCompilerUtilities::ValidateSpawnVarPinsNameConflicts(CompilerContext, this, ActorClassToSpawn, GetInternalPinNames()))
+	{
+		BreakAllNodeLinks();
+		return false;
+	}
+
+	UEdGraphPin* This_InputSoftRef = GetSoftActorPin();
+	if (!This_InputSoftRef->LinkedTo.IsEmpty())
+	{
+		FCowCompilerUtilities::NoteHardRefThroughSoftClassPin(CompilerContext, This_InputSoftRef);
+		FCowCompilerUtilities::NoteSpawnVarPinsMatchingDefaults(CompilerContext, this, ActorClassToSpawn, GetInternalPinNames());
+	}
+
+	return true;
+}
+
+UK2Node_AsyncAction* UK2Node_CowSpawnActorAsync::ExpandSpawnAction(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UFunction* Factory)
+{
+	UK2Node_AsyncAction* SpawnAction = CompilerContext.SpawnIntermediateNode<UK2Node_AsyncAction>(this, SourceGraph);
+	SpawnAction->InitializeProxyFromFunction(Factory);
+	SpawnAction->AllocateDefaultPins();
+	FCowCompilerUtilities::SetNodeGuidPinDefault(CompilerContext, SpawnAction, this);
+
+	UEdGraphPin* Action_InputActorClass = SpawnAction->FindPinChecked(Action_InputActorClassName, EGPD_Input);
+	UEdGraphPin* Action_OutputBeginSpawn = SpawnAction->FindPinChecked(Action_OutputBeginSpawnName, EGPD_Output);
+	UEdGraphPin* Action_OutputActor = SpawnAction->FindPinChecked(Action_OutputActorName, EGPD_Output);
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *SpawnAction->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *SpawnAction->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetSoftActorPin(), *Action_InputActorClass);
+
+	// Inputs that are passed as is (missing on either side are skipped, e.g. batched action takes SpawnTransforms array instead)
+	// TransformScaleMethod doesn't exist on nodes saved before it was introduced, action's default matches stock behaviour then
+	for (const FName& PinName : { Spawn_InputSpawnTransform, Spawn_InputCollisionHandlingOverride, Spawn_InputTransformScaleMethod, Spawn_InputOwner, Spawn_InputWorldContextObject })
+	{
+		UEdGraphPin* This_Input = FindPin(PinName, EGPD_Input);
+		UEdGraphPin* Action_Input = SpawnAction->FindPin(PinName, EGPD_Input);
+		if (This_Input && Action_Input)
+		{
+			CompilerContext.MovePinLinksToIntermediate(*This_Input, *Action_Input);
+		}
+	}
+
+	Action_OutputActor->PinType = GetResultPin()->PinType; // (Type match required to connect pins)
+	CompilerContext.MovePinLinksToIntermediate(*GetResultPin(), *Action_OutputActor);
+
+	//////////////////////////////////////////////////////////////////////////
+	// create 'set var' nodes
+	// Last 'then' is left unconnected, chain returns to the action which finishes the spawn
+	FCowCompilerUtilities::GenerateAssignmentNodes(CompilerContext, SourceGraph, SpawnAction, Action_OutputBeginSpawn, this, Action_OutputActor, ActorClassToSpawn, Action_InputActorClass);
+
+	return SpawnAction;
+}
+
+FText UK2Node_CowSpawnActorAsync::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (ActorClassToSpawn != nullptr)
+	{
+		if (CachedNodeTitle.IsOutOfDate(this))
+		{
+			FFormatNamedArguments Args;
+			Args.Add(TEXT("ClassName"), ActorClassToSpawn->GetDisplayNameText());
+			// FText::Format() is slow, so we cache this to save on performance
+			CachedNodeTitle.SetCachedText(FText::Format(GetNodeTitleFormat(), Args), this);
+		}
+		return CachedNodeTitle;
+	}
+
+	return GetBaseNodeTitle();
+}
+
+FName UK2Node_CowSpawnActorAsync::GetCornerIcon() const
+{
+	return TEXT("Graph.Latent.LatentIcon");
+}
+
+bool UK2Node_CowSpawnActorAsync::IsCompatibleWithGraph(const UEdGraph* TargetGraph) const
+{
+	// Can only place events in ubergraphs and macros (other code will help prevent macros with latents from ending up in functions)
+	EGraphType GraphType = TargetGraph->GetSchema()->GetGraphType(TargetGraph);
+	const bool bIsCompatible = GraphType == EGraphType::GT_Ubergraph || GraphType == EGraphType::GT_Macro;
+	return bIsCompatible && Super::IsCompatibleWithGraph(TargetGraph);
+}
+
+void UK2Node_CowSpawnActorAsync::CreatePinsForClass(UClass* InClass, TArray<UEdGraphPin*>* OutClassPins)
+{
+	// Prevent Super::CreatePinsForClass to change return type because it will introduce hard-ref to actor class
+	UEdGraphPin* ResultPin = GetResultPin();
+	auto CachedPinSubCategoryObject = ResultPin->PinType.PinSubCategoryObject;
+
+	Super::CreatePinsForClass(InClass, OutClassPins);
+
+	ResultPin->PinType.PinSubCategoryObject = CachedPinSubCategoryObject;
+}
+
+void UK2Node_CowSpawnActorAsync::PinDefaultValueChanged(UEdGraphPin* ChangedPin)
+{
+	if (ChangedPin && (ChangedPin->PinName == SoftActorClass))
+	{
+		OnSoftActorClassChanged();
+	}
+
+	Super::PinDefaultValueChanged(ChangedPin);
+}
+
+void UK2Node_CowSpawnActorAsync::PinConnectionListChanged(UEdGraphPin* ChangedPin)
+{
+	if (ChangedPin)
+	{
+		if (ChangedPin->PinName == SoftActorClass)
+		{
+			OnSoftActorClassChanged();
+		}
+		else if (ChangedPin == GetResultPin())
+		{
+			FCowCompilerUtilities::AutoWireCompletedPin(GetResultPin(), FindPinChecked(ActorSpawned, EGPD_Output));
+		}
+	}
+
+	Super::PinConnectionListChanged(ChangedPin);
+}
+
+void UK2Node_CowSpawnActorAsync::OnSoftActorClassChanged()
+{
+	UEdGraphPin* ActorClassPin = FindPin(ActorClass, EGPD_Input);
+
+	UClass* NewActorClass = GetSoftClassToSpawn();
+
+	// (Re)register in UCowNodesEditorSubsystem to update exposed pins when they're added to the new Blueprint
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
+	{
+		CowSubsystem->RegisterNode(this, NewActorClass, FSimpleDelegate::CreateUObject(this, &UK2Node_CowSpawnActorAsync::OnSoftActorClassChanged));
+	}
+
+	ActorClassToSpawn = NewActorClass;
+
+	// Linked soft class pin already introduced hard-ref to its type, otherwise don't go further than the first native class
+	UpdateResultPinTypes(IsSoftActorClassConnected() ? ActorClassToSpawn.Get() : FCowCompilerUtilities::GetFirstNativeClass(ActorClassToSpawn.Get()));
+
+	// Update Super's Class pin for Super to correctly populate exposed pins and reset it to avoid hard-ref
+	ActorClassPin->DefaultObject = ActorClassToSpawn;
+	OnClassPinChanged();
+	ActorClassPin->DefaultObject = nullptr;
+
+	TryCreateAsyncOutputPins();
+}
+
+void UK2Node_CowSpawnActorAsync::UpdateResultPinTypes(UClass* ResultClass)
+{
+	GetResultPin()->PinType.PinSubCategoryObject = ResultClass;
+}
+
+void UK2Node_CowSpawnActorAsync::UnbindFromBlueprintChange()
+{
+	if (UCowNodesEditorSubsystem* CowSubsystem = UCowNodesEditorSubsystem::Get())
+	{
+		CowSubsystem->UnregisterNode(this);
+	}
+}
+
+bool UK2Node_CowSpawnActorAsync::IsSpawnVarPin(UEdGraphPin* Pin) const
+{
+	return Super::IsSpawnVarPin(Pin) &&
+		Pin->PinName != SoftActorClass &&
+		Pin->PinName != ActorSpawned;
+}
+
+bool UK2Node_CowSpawnActorAsync::IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const
+{
+	// Fix auto-wiring uses Then instead of ActorSpawned (see UK2Node_CowCreateWidgetAsync::IsConnectionDisallowed for details)
+	if (FCowCompilerUtilities::IsThenAutoWireDisallowed(GetThenPin(), GetResultPin(), MyPin, OtherPin))
+	{
+		return true;
+	}
+
+	return Super::IsConnectionDisallowed(MyPin, OtherPin, OutReason);
+}
+
+UClass* UK2Node_CowSpawnActorAsync::GetSoftClassToSpawn() const
+{
+	return FCowCompilerUtilities::GetClassFromSoftClassPin(GetSoftActorPin());
+}
+
+bool UK2Node_CowSpawnActorAsync::IsSoftActorClassConnected() const
+{
+	return !GetSoftActorPin()->LinkedTo.IsEmpty();
+}
+
+#undef LOCTEXT_NAMESPACE
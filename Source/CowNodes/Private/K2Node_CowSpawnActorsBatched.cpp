@@ -0,0 +1,120 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowSpawnActorsBatched.h"
+
+#include "CowCompilerUtilities.h"
+#include "CowSpawnActorsBatchedAction.h"
+#include "K2Node_AsyncAction.h"
+#include "KismetCompiler.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowSpawnActorsBatched::GetBaseNodeTitle() const
+{
+	return LOCTEXT("CowSpawnActorsBatched_BaseTitle", "Cow Spawn Actors Batched");
+}
+
+FText UK2Node_CowSpawnActorsBatched::GetNodeTitleFormat() const
+{
+	return LOCTEXT("CowSpawnActorsBatched_TitleFormat", "Cow Spawn {ClassName} Batched");
+}
+
+FText UK2Node_CowSpawnActorsBatched::GetTooltipText() const
+{
+	return LOCTEXT("CowSpawnActorsBatched_Tooltip", "Loads the soft actor class asynchronously and spawns an actor per transform spread over several frames (see cow.SpawnBatched.FrameBudgetMs)");
+}
+
+void UK2Node_CowSpawnActorsBatched::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	// Single SpawnTransform of UK2Node_SpawnActorFromClass is replaced by the array
+	UEdGraphPin* SpawnTransformPin = FindPinChecked(Spawn_InputSpawnTransform, EGPD_Input);
+	SpawnTransformPin->bHidden = true;
+
+	UEdGraphNode::FCreatePinParams ArrayPinParams;
+	ArrayPinParams.ContainerType = EPinContainerType::Array;
+	ArrayPinParams.bIsReference = true;
+	ArrayPinParams.bIsConst = true;
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, TBaseStructure<FTransform>::Get(), SpawnTransforms, ArrayPinParams);
+}
+
+void UK2Node_CowSpawnActorsBatched::TryCreateAsyncOutputPins()
+{
+	Super::TryCreateAsyncOutputPins();
+
+	if (FindPin(SpawnIndex, EGPD_Output) == nullptr)
+	{
+		CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Int, SpawnIndex);
+	}
+
+	if (FindPin(AllSpawned, EGPD_Output) == nullptr)
+	{
+		CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, AllSpawned);
+	}
+
+	if (FindPin(SpawnedActors, EGPD_Output) == nullptr)
+	{
+		UEdGraphNode::FCreatePinParams ArrayPinParams;
+		ArrayPinParams.ContainerType = EPinContainerType::Array;
+		CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Object, GetResultPin()->PinType.PinSubCategoryObject.Get(), SpawnedActors, ArrayPinParams);
+	}
+}
+
+void UK2Node_CowSpawnActorsBatched::UpdateResultPinTypes(UClass* ResultClass)
+{
+	Super::UpdateResultPinTypes(ResultClass);
+
+	// Pin doesn't exist yet during the first AllocateDefaultPins, it's created with ReturnValue's type then
+	if (UEdGraphPin* SpawnedActorsPin = FindPin(SpawnedActors, EGPD_Output))
+	{
+		SpawnedActorsPin->PinType.PinSubCategoryObject = ResultClass;
+	}
+}
+
+bool UK2Node_CowSpawnActorsBatched::IsSpawnVarPin(UEdGraphPin* Pin) const
+{
+	return Super::IsSpawnVarPin(Pin) &&
+		Pin->PinName != SpawnTransforms &&
+		Pin->PinName != AllSpawned &&
+		Pin->PinName != SpawnIndex &&
+		Pin->PinName != SpawnedActors;
+}
+
+void UK2Node_CowSpawnActorsBatched::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	UK2Node_ConstructObjectFromClass::ExpandNode(CompilerContext, SourceGraph);
+
+	if (!ValidateExpansion(CompilerContext))
+	{
+		return;
+	}
+
+	// Graph for better understanding implementation details:
+	//
+	//                                      /> Then (Executed immediately after the action is activated)
+	// UCowSpawnActorsBatchedAction -------|-> BeginSpawn -> Generate assignments via SetPropertyByName (per instance, before construction script)
+	// (loads class once, spawns in        |-> Spawned -> ActorSpawned pin (per instance, ReturnValue and SpawnIndex)
+	//  time sliced batches)                \> Completed -> AllSpawned pin (SpawnedActors)
+
+	UK2Node_AsyncAction* SpawnAction = ExpandSpawnAction(CompilerContext, SourceGraph, UCowSpawnActorsBatchedAction::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UCowSpawnActorsBatchedAction, CowSpawnActorsBatched)));
+
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(SpawnTransforms, EGPD_Input), *SpawnAction->FindPinChecked(Action_InputSpawnTransformsName, EGPD_Input));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(ActorSpawned, EGPD_Output), *SpawnAction->FindPinChecked(Action_OutputSpawnedName, EGPD_Output));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(AllSpawned, EGPD_Output), *SpawnAction->FindPinChecked(Action_OutputCompletedName, EGPD_Output));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(SpawnIndex, EGPD_Output), *SpawnAction->FindPinChecked(Action_OutputIndexName, EGPD_Output));
+
+	UEdGraphPin* This_OutputSpawnedActors = FindPinChecked(SpawnedActors, EGPD_Output);
+	UEdGraphPin* Action_OutputActors = SpawnAction->FindPinChecked(Action_OutputActorsName, EGPD_Output);
+	Action_OutputActors->PinType = This_OutputSpawnedActors->PinType; // (Type match required to connect pins)
+	CompilerContext.MovePinLinksToIntermediate(*This_OutputSpawnedActors, *Action_OutputActors);
+
+	BreakAllNodeLinks();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,263 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "K2Node_CowSwitchOnSoftClass.h"
+
+// Engine
+#include "AssetRegistry/IAssetRegistry.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_MakeArray.h"
+#include "K2Node_SwitchInteger.h"
+#include "KismetCompiler.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+// Cow
+#include "CowClassAncestry.h"
+#include "CowCompilerUtilities.h"
+#include "CowFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "Cow"
+
+FText UK2Node_CowSwitchOnSoftClass::GetMenuCategory() const
+{
+	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::FlowControl);
+}
+
+FText UK2Node_CowSwitchOnSoftClass::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("CowSwitchOnSoftClassNodeTitle", "Cow Switch on Soft Class");
+}
+
+FText UK2Node_CowSwitchOnSoftClass::GetTooltipText() const
+{
+	return LOCTEXT("CowSwitchOnSoftClassTooltip", "Executes the first case Selection is child of (Default if none). No class is loaded, parents of unloaded Blueprints are read from asset registry");
+}
+
+void UK2Node_CowSwitchOnSoftClass::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	// Registered under the node's class (see UK2Node_CowGetAllActorsOfClass::GetMenuActions)
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+void UK2Node_CowSwitchOnSoftClass::AllocateDefaultPins()
+{
+	Super::AllocateDefaultPins();
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+
+	FEdGraphPinType SelectionPinType;
+	SelectionPinType.PinCategory = UEdGraphSchema_K2::PC_SoftClass;
+	SelectionPinType.PinSubCategoryObject = UObject::StaticClass();
+	CreatePin(EGPD_Input, SelectionPinType, SelectionName);
+
+	for (const FSoftObjectPath& CasePath : GetCasePaths())
+	{
+		UEdGraphPin* CasePin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, GetCasePinName(CasePath));
+		FString ClassName = CasePath.GetAssetName();
+		ClassName.RemoveFromEnd(TEXT("_C"));
+		CasePin->PinFriendlyName = FText::FromString(ClassName);
+		CasePin->PinToolTip = CasePath.ToString();
+	}
+
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, DefaultName);
+}
+
+void UK2Node_CowSwitchOnSoftClass::ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins)
+{
+	Super::ReallocatePinsDuringReconstruction(OldPins);
+
+	// Pins are matched by name, so an old case pin whose path no longer exists is renamed before rewiring:
+	//  1. to the new path of the class if it was moved or renamed and PinClasses already points there
+	//  2. otherwise to the case at the same position if nothing else claims it (class of a case was changed in the details panel)
+	const TArray<FSoftObjectPath> CasePaths = GetCasePaths();
+	TSet<FName> ClaimedNames;
+	TArray<TPair<UEdGraphPin*, int32>, TInlineAllocator<4>> UnmatchedPins;
+	int32 OldCaseIndex = 0;
+	for (UEdGraphPin* OldPin : OldPins)
+	{
+		if (OldPin->Direction != EGPD_Output || OldPin->PinName == DefaultName)
+		{
+			continue;
+		}
+
+		if (FindPin(OldPin->PinName, EGPD_Output))
+		{
+			ClaimedNames.Add(OldPin->PinName);
+		}
+		else
+		{
+			UnmatchedPins.Emplace(OldPin, OldCaseIndex);
+		}
+		++OldCaseIndex;
+	}
+
+	for (const TPair<UEdGraphPin*, int32>& Unmatched : UnmatchedPins)
+	{
+		const FName RedirectedName = GetCasePinName(RedirectCasePath(FSoftObjectPath(Unmatched.Key->PinName.ToString())));
+		if (!ClaimedNames.Contains(RedirectedName) && FindPin(RedirectedName, EGPD_Output))
+		{
+			Unmatched.Key->PinName = RedirectedName;
+			ClaimedNames.Add(RedirectedName);
+		}
+	}
+
+	for (const TPair<UEdGraphPin*, int32>& Unmatched : UnmatchedPins)
+	{
+		if (ClaimedNames.Contains(Unmatched.Key->PinName) || !CasePaths.IsValidIndex(Unmatched.Value))
+		{
+			continue;
+		}
+
+		const FName SamePositionName = GetCasePinName(CasePaths[Unmatched.Value]);
+		if (!ClaimedNames.Contains(SamePositionName))
+		{
+			Unmatched.Key->PinName = SamePositionName;
+			ClaimedNames.Add(SamePositionName);
+		}
+	}
+}
+
+void UK2Node_CowSwitchOnSoftClass::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_CowSwitchOnSoftClass, PinClasses))
+	{
+		ReconstructNode();
+		GetGraph()->NotifyGraphChanged();
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+void UK2Node_CowSwitchOnSoftClass::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	FCowCompilerUtilities::FExpansionStats& ExpansionStats = FCowCompilerUtilities::GetExpansionStats();
+	FScopedDurationTimer ExpansionTimer(ExpansionStats.Seconds);
+	++ExpansionStats.ExpandedNodes;
+
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	const TArray<FSoftObjectPath> CasePaths = GetCasePaths();
+
+	// First matching case wins, so case after its parent is dead code
+	for (int32 CaseIndex = 1; CaseIndex < CasePaths.Num(); ++CaseIndex)
+	{
+		for (int32 ParentIndex = 0; ParentIndex < CaseIndex; ++ParentIndex)
+		{
+			if (FCowClassAncestry::Get().IsChildOf(CasePaths[CaseIndex], CasePaths[ParentIndex]))
+			{
+				CompilerContext.MessageLog.Warning(*FText::Format(LOCTEXT("CowSwitchOnSoftClass_UnreachableCase", "Case {0} of @@ is never executed, it's a child of {1} which goes first"),
+					FText::FromString(CasePaths[CaseIndex].GetAssetName()), FText::FromString(CasePaths[ParentIndex].GetAssetName())).ToString(), this);
+				break;
+			}
+		}
+	}
+
+	// Graph for better understanding implementation details:
+	//
+	// MakeArray (case classes) -> CowSwitchOnSoftClass (Selection) -> SwitchInteger --|-> 0..N-1 (case pins)
+	//                                                                                  \> Default (INDEX_NONE)
+
+	UK2Node_CallFunction* Call_Switch = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	Call_Switch->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UCowFunctionLibrary, CowSwitchOnSoftClass), UCowFunctionLibrary::StaticClass());
+	Call_Switch->AllocateDefaultPins();
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(SelectionName, EGPD_Input), *Call_Switch->FindPinChecked(Function_InputClassName, EGPD_Input));
+
+	if (!CasePaths.IsEmpty())
+	{
+		UK2Node_MakeArray* MakeCases = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
+		MakeCases->AllocateDefaultPins();
+		for (int32 CaseIndex = 1; CaseIndex < CasePaths.Num(); ++CaseIndex)
+		{
+			MakeCases->AddInputPin();
+		}
+
+		UEdGraphPin* MakeCases_OutputArray = MakeCases->GetOutputPin();
+		MakeCases_OutputArray->MakeLinkTo(Call_Switch->FindPinChecked(Function_InputCasesName, EGPD_Input));
+		// Takes element type from the Cases param
+		MakeCases->PinConnectionListChanged(MakeCases_OutputArray);
+
+		int32 CaseIndex = 0;
+		for (UEdGraphPin* ElementPin : MakeCases->Pins)
+		{
+			if (ElementPin->Direction == EGPD_Input)
+			{
+				ElementPin->DefaultValue = CasePaths[CaseIndex++].ToString();
+			}
+		}
+	}
+
+	UK2Node_SwitchInteger* SwitchOnIndex = CompilerContext.SpawnIntermediateNode<UK2Node_SwitchInteger>(this, SourceGraph);
+	SwitchOnIndex->AllocateDefaultPins();
+	for (int32 CaseIndex = 0; CaseIndex < CasePaths.Num(); ++CaseIndex)
+	{
+		SwitchOnIndex->AddPinToSwitchNode();
+	}
+	Call_Switch->GetReturnValuePin()->MakeLinkTo(SwitchOnIndex->GetSelectionPin());
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *SwitchOnIndex->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(DefaultName, EGPD_Output), *SwitchOnIndex->GetDefaultPin());
+	for (int32 CaseIndex = 0; CaseIndex < CasePaths.Num(); ++CaseIndex)
+	{
+		// SwitchInteger names its pins by the case value (StartIndex is 0)
+		UEdGraphPin* SwitchOnIndex_CasePin = SwitchOnIndex->FindPinChecked(FName(*FString::FromInt(CaseIndex)), EGPD_Output);
+		CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GetCasePinName(CasePaths[CaseIndex]), EGPD_Output), *SwitchOnIndex_CasePin);
+	}
+
+	BreakAllNodeLinks();
+}
+
+TArray<FSoftObjectPath> UK2Node_CowSwitchOnSoftClass::GetCasePaths() const
+{
+	TArray<FSoftObjectPath> CasePaths;
+	CasePaths.Reserve(PinClasses.Num());
+	for (const TSoftClassPtr<UObject>& PinClass : PinClasses)
+	{
+		if (!PinClass.IsNull())
+		{
+			CasePaths.AddUnique(PinClass.ToSoftObjectPath());
+		}
+	}
+	return CasePaths;
+}
+
+FName UK2Node_CowSwitchOnSoftClass::GetCasePinName(const FSoftObjectPath& CasePath)
+{
+	return FName(*CasePath.ToString());
+}
+
+FSoftObjectPath UK2Node_CowSwitchOnSoftClass::RedirectCasePath(const FSoftObjectPath& CasePath)
+{
+	FSoftObjectPath Redirected = CasePath;
+	Redirected.FixupCoreRedirects();
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	const FSoftObjectPath AssetRedirected = AssetRegistry.GetRedirectedObjectPath(Redirected);
+	if (AssetRedirected != Redirected)
+	{
+		return AssetRedirected;
+	}
+
+	// Asset registry knows the redirector of the Blueprint, not of its generated class
+	FString BlueprintName = Redirected.GetAssetName();
+	if (BlueprintName.RemoveFromEnd(TEXT("_C")))
+	{
+		const FSoftObjectPath BlueprintPath(Redirected.GetLongPackageFName(), FName(*BlueprintName), FString());
+		const FSoftObjectPath RedirectedBlueprintPath = AssetRegistry.GetRedirectedObjectPath(BlueprintPath);
+		if (RedirectedBlueprintPath != BlueprintPath)
+		{
+			return FSoftObjectPath(RedirectedBlueprintPath.GetLongPackageFName(), FName(RedirectedBlueprintPath.GetAssetName() + TEXT("_C")), FString());
+		}
+	}
+	return Redirected;
+}
+
+#undef LOCTEXT_NAMESPACE
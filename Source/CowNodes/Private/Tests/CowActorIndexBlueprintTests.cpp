@@ -0,0 +1,60 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Engine/Blueprint.h"
+#include "Engine/Engine.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+// Cow
+#include "CowActorIndexSubsystem.h"
+#include "CowBenchmarkUtilities.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCowActorIndexDeferredBlueprintTest, "Cow.ActorIndex.DeferredBlueprintRoot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+// Root of a Blueprint comes from its construction script, deferred spawns are indexed before it exists
+bool FCowActorIndexDeferredBlueprintTest::RunTest(const FString& Parameters)
+{
+	UBlueprint* Blueprint = FCowBenchmarkUtilities::CreateTransientBlueprint(AActor::StaticClass(), TEXT("BP_CowDeferredRootTest"));
+	USimpleConstructionScript* ConstructionScript = Blueprint->SimpleConstructionScript;
+	USCS_Node* RootNode = ConstructionScript->CreateNode(USceneComponent::StaticClass(), TEXT("Root"));
+	// Static roots are dropped from the refresh once final, the actor has to be read after construction before that
+	CastChecked<USceneComponent>(RootNode->ComponentTemplate)->SetMobility(EComponentMobility::Static);
+	ConstructionScript->AddNode(RootNode);
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+	UClass* Class = Blueprint->GeneratedClass;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/ false, TEXT("CowActorIndexTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// Builds the index, so the actor below is added by the spawned handler
+	TestNull(TEXT("Nothing is found in an empty world"), Cow::FindNearestActor<AActor>(World, FVector::ZeroVector));
+
+	const FTransform Transform(FVector(1000.0, 0.0, 0.0));
+	AActor* Actor = World->SpawnActorDeferred<AActor>(Class, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	TestNull(TEXT("Root doesn't exist before FinishSpawning"), Actor->GetRootComponent());
+	Actor->FinishSpawning(Transform);
+
+	int32 Found = 0;
+	Cow::ForEachActorInRadius<AActor>(World, Transform.GetLocation(), 100.f, [&Found, Actor](AActor& Candidate)
+	{
+		Found += &Candidate == Actor;
+	});
+	TestEqual(TEXT("Radius query finds the deferred actor"), Found, 1);
+	TestEqual(TEXT("Nearest actor is the deferred actor"), Cow::FindNearestActor<AActor>(World, FVector::ZeroVector), Actor);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,41 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CowActorQueryBenchmarkCommandlet.generated.h"
+
+/**
+ * Runtime cost of actor-of-class queries at scale
+ *
+ * Spawns N actors in a headless game world using mixed native and Blueprint class hierarchies:
+ *	AActor <- BP_CowBenchmarkBase <- BP_CowBenchmarkTarget (queried class)
+ *								  <- BP_CowBenchmarkSibling
+ *	AActor <- ATargetPoint
+ * HitRatio percent of actors are BP_CowBenchmarkTarget, the rest are evenly distributed among the other classes
+ * Actors are placed randomly (fixed seed) in a 100k cube centered at the origin
+ *
+ * Every query (UCowFunctionLibrary::CowGetAllActorsOfClass, CowGetActorOfClass and UGameplayStatics::GetAllActorsOfClass)
+ * is executed Iterations times and reports median, p99 and game thread allocations per call
+ *
+ * Shape filtering is measured three ways: Blueprint style (CowGetAllActorsOfClass and a GetActorLocation distance check per actor),
+ * CowGetAllActorsOfClassInShape, and Cow::Kernels scalar vs SIMD over packed positions of the target class
+ * Output arrays are reused between calls the same way ubergraph persistent frame reuses them
+ *
+ * Usage:
+ *	UnrealEditor-Cmd <Project>.uproject -run=CowActorQueryBenchmark -unattended -nullrhi
+ *		[-ActorCounts=1000,10000,100000] [-HitRatios=0.1,10,100] [-Iterations=100] [-Output=<Path>.csv]
+ *
+ * By default results are written to <Project>/Saved/CowNodes/ActorQueryBenchmark.csv
+ */
+UCLASS()
+class COWNODES_API UCowActorQueryBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCowActorQueryBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+
+// Small helpers shared by Cow benchmark commandlets
+namespace FCowBenchmarkUtilities
+{
+	// Parses comma separated list of integers passed as -Key=1,2,3, returns Default if the key is missing
+	COWNODES_API TArray<int32> ParseIntList(const FString& Params, const TCHAR* Key, const TArray<int32>& Default);
+	COWNODES_API TArray<double> ParseDoubleList(const FString& Params, const TCHAR* Key, const TArray<double>& Default);
+
+	// Nearest-rank percentile (0..100), Samples don't need to be sorted
+	COWNODES_API double Percentile(TArray<double> Samples, double Percent);
+	FORCEINLINE double Median(const TArray<double>& Samples) { return Percentile(Samples, 50.0); }
+
+	/**
+	 * Creates (not compiled) Blueprint in its own transient /Temp/CowNodesBenchmark package
+	 * /Temp packages are never saved but soft paths to them resolve just fine
+	 */
+	COWNODES_API UBlueprint* CreateTransientBlueprint(UClass* ParentClass, const FString& AssetName, UClass* BlueprintClass = nullptr, UClass* GeneratedClass = nullptr);
+
+	// -Output=<Path> if specified, otherwise <Project>/Saved/CowNodes/DefaultFileName
+	COWNODES_API FString GetOutputPath(const FString& Params, const FString& DefaultFileName);
+
+	// Writes Header + Rows to Path (creating directories), logs the result
+	COWNODES_API bool WriteCsv(const FString& Path, const FString& Header, const TArray<FString>& Rows);
+}
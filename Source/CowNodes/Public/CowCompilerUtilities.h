@@ -5,11 +5,59 @@
 #include "CoreMinimal.h"
 
 class FKismetCompilerContext;
+struct FBPTerminal;
+struct FKismetFunctionContext;
 
 namespace FCowCompilerUtilities
 {
+	// Accumulated cost of ExpandNode of all Cow nodes, reset and read by UCowNodesBenchmarkCommandlet
+	struct FExpansionStats
+	{
+		double Seconds = 0.0;
+		int32 ExpandedNodes = 0;
+	};
+	COWNODES_API FExpansionStats& GetExpansionStats();
+
 	COWNODES_API const UClass* GetFirstNativeClass(const UClass* Child);
 	COWNODES_API UClass* GetFirstNativeClass(UClass* Child);
+
+	// Name of FGuid parameter of Cow runtime functions/actions that receives GUID of the node that issued the call (see CowTrace.h)
+	inline const FName NodeGuidParamName = TEXT("NodeGuid");
+
+	// Bakes SourceNode's GUID into NodeGuid pin of the intermediate node (no-op if the function has no such parameter)
+	COWNODES_API void SetNodeGuidPinDefault(const FKismetCompilerContext& CompilerContext, UEdGraphNode* IntermediateNode, const UEdGraphNode* SourceNode);
+
+	// Literal FGuid term with Node's GUID for node handlers that emit calls directly (no pins to take the value from)
+	COWNODES_API FBPTerminal* CreateNodeGuidLiteral(FKismetFunctionContext& Context, UEdGraphNode* Node);
+
+	// Same filter UK2Node_ConstructObjectFromClass::CreatePinsForClass uses to decide whether the property gets a pin
+	COWNODES_API bool IsExposedOnSpawnProperty(const FProperty* Property);
+
+	// Class selected in a soft class pin: loaded from DefaultValue path or taken from the type of the linked pin
+	COWNODES_API UClass* GetClassFromSoftClassPin(const UEdGraphPin* SoftClassPin);
+
+	// Used by auto-wiring of Cow async nodes, OutFirstUnconnectedPin is the first input exec pin without links
+	COWNODES_API bool IsAnyInputExecPinsConnected(const TArray<UEdGraphPin*>& Pins, UEdGraphPin*& OutFirstUnconnectedPin);
+
+	// Auto-wiring of Cow async nodes: when ResultPin gets its only link to a node with no connected execs,
+	// CompletedPin (not Then) is wired to that node (call from PinConnectionListChanged of ResultPin)
+	COWNODES_API void AutoWireCompletedPin(UEdGraphPin* ResultPin, UEdGraphPin* CompletedPin);
+
+	// Counterpart of AutoWireCompletedPin for IsConnectionDisallowed, prevents editor's auto-wire of Then to the node ResultPin is linked to
+	COWNODES_API bool IsThenAutoWireDisallowed(const UEdGraphPin* ThenPin, const UEdGraphPin* ResultPin, const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin);
+
+	// Blueprint class SoftClassPin holds hard-ref to through the type of the linked pin, nullptr if it's not linked or the type is native
+	COWNODES_API UClass* GetHardRefThroughSoftClassPin(const UEdGraphPin* SoftClassPin);
+
+	// Note for user if linked SoftClassPin introduced hard-ref (see GetHardRefThroughSoftClassPin)
+	COWNODES_API void NoteHardRefThroughSoftClassPin(const FKismetCompilerContext& CompilerContext, const UEdGraphPin* SoftClassPin);
+
+	// Notes for ExposeOnSpawn pins of SpawnNode whose default value equals ClassToSpawn's CDO value (InternalPinNames are skipped)
+	// @note: Makes sense only when soft class pin is linked (meaning at runtime the class may be different)
+	COWNODES_API void NoteSpawnVarPinsMatchingDefaults(const FKismetCompilerContext& CompilerContext, const UEdGraphNode* SpawnNode, const UClass* ClassToSpawn, TConstArrayView<FName> InternalPinNames);
+
+	// Error for every ExposeOnSpawn property of ClassToSpawn conflicting with InternalPinNames (such property never gets a pin)
+	COWNODES_API bool ValidateSpawnVarPinsNameConflicts(const FKismetCompilerContext& CompilerContext, const UEdGraphNode* SpawnNode, const UClass* ClassToSpawn, TConstArrayView<FName> InternalPinNames);
 	
 	/**
 	 * Copy-paste of 5.5.3 FKismetCompilerUtilities::GenerateAssignmentNodes
@@ -18,4 +66,8 @@ namespace FCowCompilerUtilities
 	 *	1. Fixed hard-ref introduced when generating assignments for BlueprintSetter
 	 */
 	COWNODES_API UEdGraphPin* GenerateAssignmentNodes(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UK2Node* CallBeginSpawnNode, UEdGraphNode* SpawnNode, UEdGraphPin* CallBeginResult, const UClass* ForClass, const UEdGraphPin* CallBeginClassInput = nullptr);
+
+	// Same as above but assignments are chained starting from CallBeginThen instead of CallBeginSpawnNode's Then pin
+	// (e.g. completion pin of an async action)
+	COWNODES_API UEdGraphPin* GenerateAssignmentNodes(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UK2Node* CallBeginSpawnNode, UEdGraphPin* CallBeginThen, UEdGraphNode* SpawnNode, UEdGraphPin* CallBeginResult, const UClass* ForClass, const UEdGraphPin* CallBeginClassInput = nullptr);
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CowConvertNodesCommandlet.generated.h"
+
+/**
+ * Replaces stock nodes that create hard-refs with Cow equivalents in every Blueprint under given paths
+ *
+ *  - CreateWidget -> CowCreateWidgetAsync (ExposeOnSpawn values and links are kept, whatever was after Then goes to WidgetCreated)
+ *  - GetAllActorsOfClass/GetActorOfClass -> CowGetAllActorsOfClass (array/single version)
+ *
+ * Node is left as is (and reported) if:
+ *  - Class pin is linked (hard-ref is already there, nothing to win)
+ *  - Graph doesn't support async nodes (functions can't have CowCreateWidgetAsync)
+ *  - Result is used as the exact class (Cow node returns the first native class, result would need a cast which is the same hard-ref)
+ *
+ * Converted Blueprints are compiled and saved only if compilation succeeded, files have to be writable (no source control checkout)
+ * Level Blueprints aren't converted (maps aren't loaded)
+ *
+ * Reports hard dependency closure (packages and bytes, see FCowHardRefUtilities) of every converted package before and after
+ *
+ * Usage:
+ *	UnrealEditor-Cmd <Project>.uproject -run=CowConvertNodes -unattended -nullrhi
+ *		[-Paths=/Game,/MyPlugin] [-DryRun] [-Output=<Path>.csv]
+ *
+ * -DryRun only counts nodes that would be converted, with the same validation as a real run
+ * (Cow nodes are spawned and removed again in memory), nothing is saved
+ * By default report is written to <Project>/Saved/CowNodes/ConvertNodes.csv
+ */
+UCLASS()
+class COWNODES_API UCowConvertNodesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCowConvertNodesCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+// ExposeOnSpawn property of a class with everything compilation of Cow nodes needs to know about it
+struct COWNODES_API FCowExposedProperty
+{
+	FProperty* Property = nullptr;
+
+	// BlueprintSetter resolved on the first native class (see FCowCompilerUtilities::GenerateAssignmentNodes), nullptr if none
+	UFunction* SetFunction = nullptr;
+
+	// FBlueprintEditorUtils::PropertyValueToString of the class CDO, valid only if bHasCDODefaultValue
+	FString CDODefaultValue;
+	bool bHasCDODefaultValue = false;
+};
+
+struct COWNODES_API FCowClassExposedProperties
+{
+	TArray<FCowExposedProperty> Properties;
+
+	const FCowExposedProperty* Find(FName PropertyName) const;
+
+private:
+	friend class FCowExposedPropertyCache;
+
+	TMap<FName, int32> NameToIndex;
+
+	// Both are used to detect stale entries, CDO is recreated by every full Blueprint compilation and relinking recreates properties
+	TWeakObjectPtr<UObject> ClassDefaultObject;
+	const FProperty* PropertyLink = nullptr;
+};
+
+/**
+ * Per class cache of ExposeOnSpawn properties shared by all Cow nodes
+ *
+ * Every compile used to walk TFieldIterator and stringify CDO values for every node (sometimes several times per node),
+ * with hundreds of Cow nodes in a project that added up to a noticeable part of full Blueprint compilation
+ *
+ * Entries are invalidated when:
+ *  - Class CDO or property layout changes (full Blueprint compilation)
+ *  - Class or its CDO get reinstanced (FCoreUObjectDelegates::OnObjectsReplaced)
+ *  - Default of a CDO is edited in place, e.g. in Class Defaults (FCoreUObjectDelegates::OnObjectPropertyChanged), children included
+ *  - Blueprint of the class or of one of its parents starts compiling, compilations that keep the CDO don't replace anything
+ *  - Hot reload/live coding finishes
+ * Classes with Blueprint being compiled right now are never cached (their layout is in the middle of change)
+ */
+class COWNODES_API FCowExposedPropertyCache
+{
+public:
+	static FCowExposedPropertyCache& Get();
+	static void Shutdown();
+
+	~FCowExposedPropertyCache();
+
+	TSharedRef<const FCowClassExposedProperties> GetClassProperties(const UClass* Class);
+
+	// Replacement for FBlueprintCompilationManager::GetDefaultValue + FBlueprintEditorUtils::PropertyValueToString(CDO) pair
+	static bool GetDefaultValue(const UClass* Class, const FCowExposedProperty& ExposedProperty, FString& OutDefaultValueAsString);
+
+	void Invalidate(const UClass* Class);
+	// Class and every cached class derived from it (their CDOs inherit defaults of Class)
+	void InvalidateWithChildren(const UClass* Class);
+	void InvalidateAll();
+
+private:
+	FCowExposedPropertyCache();
+
+	static bool IsClassBeingCompiled(const UClass* Class);
+	static TSharedRef<FCowClassExposedProperties> BuildClassProperties(const UClass* Class);
+
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+	// GEditor may not exist yet when the cache is created by compilation during editor startup
+	void BindEditorDelegates();
+
+	TMap<TObjectKey<UClass>, TSharedRef<FCowClassExposedProperties>> Cache;
+
+	FDelegateHandle OnObjectsReplacedHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnReloadCompleteHandle;
+	FDelegateHandle OnPostEngineInitHandle;
+	FDelegateHandle OnBlueprintPreCompileHandle;
+};
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CowHardRefAuditCommandlet.generated.h"
+
+/**
+ * Hard reference footprint of every Blueprint and map under given paths, written as JSON that can be diffed and used as a baseline
+ *
+ * For every asset:
+ *  - Transitive hard closure (packages and bytes, see FCowHardRefUtilities)
+ *  - Direct hard edges with the closure each of them drags in and what created the edge
+ *    (graph node, variable, component, parent class or interface, "Unattributed" for everything else like default values)
+ *  - Stock nodes that a Cow node could replace (only ones with a Blueprint class selected, see FCowHardRefUtilities::GetCowReplacement)
+ *  - Soft class pins that still got a hard-ref from a linked hard class (same as "You introduced hard-ref" compiler note)
+ *
+ * Maps get the closure and edges only, they aren't loaded so Level Blueprint nodes aren't attributed
+ * Everything is sorted so the file only changes when references do
+ *
+ * Usage:
+ *	UnrealEditor-Cmd <Project>.uproject -run=CowHardRefAudit -unattended -nullrhi
+ *		[-Paths=/Game,/MyPlugin] [-Output=<Path>.json] [-Baseline=<Path>.json] [-Tolerance=<Percent>]
+ *
+ * With -Baseline commandlet fails (returns 1) if any asset from the baseline got a bigger closure (more than Tolerance percent, 0 by default),
+ * more replaceable nodes or more hard-ref notes. New assets aren't regressions, commit the new report as the next baseline
+ * By default report is written to <Project>/Saved/CowNodes/HardRefAudit.json
+ */
+UCLASS()
+class COWNODES_API UCowHardRefAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCowHardRefAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,36 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraphNode;
+
+// Hard reference footprint helpers shared by Cow commandlets, dependencies come from asset registry (nothing is loaded)
+namespace FCowHardRefUtilities
+{
+	struct FClosure
+	{
+		// Packages loaded together with the root (root itself isn't counted)
+		int32 Packages = 0;
+		// Sum of their on-disk sizes
+		int64 Bytes = 0;
+	};
+
+	// Transitive hard package dependencies of PackageName, script (/Script/...) packages are skipped because they are always loaded
+	// OutPackages if provided receives every package of the closure
+	COWNODES_API FClosure ComputeHardClosure(FName PackageName, TSet<FName>* OutPackages = nullptr);
+
+	// Direct hard package dependencies of PackageName without script packages
+	COWNODES_API TArray<FName> GetDirectHardDependencies(FName PackageName);
+
+	// On-disk size from asset registry package data, 0 if unknown
+	COWNODES_API int64 GetPackageDiskSize(FName PackageName);
+
+	// Name of Cow node that does the same as stock Node without its hard-ref to a Blueprint class, nullptr if there is none
+	// (the node has to have Blueprint class selected in its class pin, native classes are always loaded anyway)
+	COWNODES_API const TCHAR* GetCowReplacement(const UEdGraphNode* Node);
+
+	// Asset registry doesn't notice packages saved by commandlets, rescan them to get up to date dependencies
+	COWNODES_API void RescanPackages(const TArray<FName>& PackageNames);
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Editor-side cache: soft class path -> first native class of that class
+ *
+ * Resolving it requires asset registry lookup, tags parsing and ResolveName/FindObject
+ * and nodes ask for it on every PostLoad, PostReconstructNode, pin change and ExpandNode,
+ * which is a lot of repeated work when loading/compiling large level Blueprints
+ *
+ * Entries are invalidated by asset registry add/remove/rename/update events for their package (and all of them once initial scan is finished),
+ * update covers reparenting: NativeParentClassPath tag changes when the reparented Blueprint is saved
+ * Failed lookups are never cached (asset could simply not be discovered yet)
+ */
+class COWNODES_API FCowNativeClassCache
+{
+public:
+	static FCowNativeClassCache& Get();
+	static void Shutdown();
+
+	~FCowNativeClassCache();
+
+	// If class is blueprint we get native parent from asset registry tags to avoid loading the class
+	UClass* FindNativeClass(const FSoftObjectPath& SoftClassPath);
+
+	void InvalidateAll();
+
+private:
+	FCowNativeClassCache();
+
+	static UClass* ResolveNativeClass(const FSoftObjectPath& SoftClassPath);
+
+	void InvalidatePackage(FName PackageName);
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+	TMap<FSoftObjectPath, TWeakObjectPtr<UClass>> Cache;
+	TMultiMap<FName, FSoftObjectPath> PackageToPaths;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
+	FDelegateHandle OnFilesLoadedHandle;
+};
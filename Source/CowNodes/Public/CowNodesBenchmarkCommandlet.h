@@ -0,0 +1,36 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CowNodesBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures what Cow nodes cost the Blueprint compiler compared to stock CreateWidget and GetAllActorsOfClass
+ *
+ * For every combination of node count and ExposeOnSpawn variable count it generates a transient Actor Blueprint
+ * with N nodes chained from BeginPlay, compiles it repeatedly and reports:
+ *  - Total compile time (median/min/max of all iterations, first compilation is a warm up and isn't counted)
+ *  - Time spent in ExpandNode of Cow nodes (see FCowCompilerUtilities::GetExpansionStats)
+ *  - Number of nodes in intermediate graphs (what actually goes to the backend)
+ *  - Bytecode size of the generated class
+ *
+ * Cow nodes are measured with both compact and legacy code generation (see UCowNodesSettings::bCompactCodeGeneration)
+ *
+ * Usage:
+ *	UnrealEditor-Cmd <Project>.uproject -run=CowNodesBenchmark -unattended -nullrhi
+ *		[-NodeCounts=1,10,100] [-ExposedCounts=0,4,16] [-Iterations=5] [-Output=<Path>.csv]
+ *
+ * By default results are written to <Project>/Saved/CowNodes/CompileBenchmark.csv
+ */
+UCLASS()
+class COWNODES_API UCowNodesBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCowNodesBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "CowNodesEditorSubsystem.generated.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+/**
+ * Owns Blueprint->OnChanged bindings for Cow nodes that generate pins from a Blueprint class
+ *
+ * Previously every node bound its own lambda and rebuilt pins on every OnChanged,
+ * so recompiling a base widget used by 200 nodes meant 200 full reconstructions (per broadcast!)
+ *
+ * Now:
+ *  - There is a single binding per Blueprint no matter how many nodes use it
+ *  - All OnChanged events are collapsed per Blueprint and processed once on the next tick
+ *  - Nodes are refreshed only if the hash of the class ExposeOnSpawn signature actually changed
+ */
+UCLASS()
+class COWNODES_API UCowNodesEditorSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// May return nullptr (e.g. -game with editor binaries or editor is shutting down)
+	static UCowNodesEditorSubsystem* Get();
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Start tracking Class's Blueprint for the Node (replaces previous registration of the Node if any)
+	 * OnSignatureChanged is executed when ExposeOnSpawn signature of the Class changes
+	 *
+	 * @note: Safe to call repeatedly, registering for the same Blueprint is no-op
+	 *		  Passing native class or nullptr simply unregisters the Node
+	 */
+	void RegisterNode(const UEdGraphNode* Node, UClass* Class, FSimpleDelegate OnSignatureChanged);
+	void UnregisterNode(const UEdGraphNode* Node);
+
+	// Hash of everything that affects pins generated for ExposeOnSpawn properties (names, types and advanced display)
+	static uint32 CalculateExposeOnSpawnSignature(const UClass* Class);
+
+private:
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+	bool ProcessPendingChanges(float DeltaTime);
+
+	struct FTrackedNode
+	{
+		TWeakObjectPtr<const UEdGraphNode> Node;
+		FSimpleDelegate OnSignatureChanged;
+	};
+
+	struct FTrackedBlueprint
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		FDelegateHandle OnChangedHandle;
+		uint32 Signature = 0;
+		TArray<FTrackedNode> Nodes;
+	};
+
+	void UnbindBlueprint(FTrackedBlueprint& Tracked);
+
+	TMap<TObjectKey<UBlueprint>, FTrackedBlueprint> TrackedBlueprints;
+	TMap<TObjectKey<UEdGraphNode>, TObjectKey<UBlueprint>> NodeToBlueprint;
+
+	// Blueprints that broadcasted OnChanged since last processing
+	TSet<TObjectKey<UBlueprint>> PendingBlueprints;
+	FTSTicker::FDelegateHandle PendingTickHandle;
+};
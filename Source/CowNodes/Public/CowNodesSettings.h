@@ -0,0 +1,46 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "CowNodesSettings.generated.h"
+
+/**
+ * Project settings of Cow nodes (Project Settings -> Plugins -> Cow Nodes)
+ */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "Cow Nodes"))
+class COWNODES_API UCowNodesSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UCowNodesSettings();
+
+	/**
+	 * Generate minimal code for Cow nodes instead of expanding them into a chain of intermediate nodes:
+	 *  - CowGetAllActorsOfClass emits a single function call statement (see FKCHandler_CowGetAllActorsOfClass)
+	 *  - CowCreateWidgetAsync loads and creates the widget natively (see UCowCreateWidgetAsyncAction)
+	 *
+	 * Behaves the same as the expanded graph (including dropped executions while CowCreateWidgetAsync is loading),
+	 * disable only if you suspect a problem in the generated code
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Compilation")
+	bool bCompactCodeGeneration = true;
+
+	/**
+	 * Write soft references of CowCreateWidgetAsync, CowSpawnActorAsync, CowConstructObjectAsync and CowLoadAssets nodes
+	 * to asset registry tag of Blueprints and maps that use them (see FCowSoftReferenceManifest), UCowPrefetchSubsystem needs it
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Cooking")
+	bool bWriteSoftReferenceManifest = true;
+
+	/**
+	 * Also put them into "Cow" asset bundle of maps, so asset manager (and its chunk assignment) sees them as used by the map
+	 * Makes sense only if maps are primary assets
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Cooking", meta = (EditCondition = "bWriteSoftReferenceManifest"))
+	bool bRegisterAssetBundles = false;
+
+	static bool UseCompactCodeGeneration();
+};
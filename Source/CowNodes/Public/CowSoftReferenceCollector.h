@@ -0,0 +1,29 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UWorld;
+
+/**
+ * Editor part of FCowSoftReferenceManifest: collects soft references of Cow nodes that load something
+ * and adds them as asset registry tag to Blueprints and maps when they are saved or cooked
+ *
+ * Only unlinked pins with a value are collected (and elements of MakeArray linked to CowLoadAssets),
+ * whatever comes through a link is known only at runtime. Query nodes (CowGetAllActorsOfClass etc.) never load their class,
+ * so prefetching it would only make things worse
+ *
+ * Map gets references of its Level Blueprint and of Blueprint actors in its persistent level (including parent Blueprints),
+ * World Partition actors live in their own packages and aren't included
+ */
+namespace FCowSoftReferenceCollector
+{
+	COWNODES_API void CollectFromBlueprint(const UBlueprint* Blueprint, TArray<FSoftObjectPath>& OutPaths);
+	COWNODES_API void CollectFromWorld(const UWorld* World, TArray<FSoftObjectPath>& OutPaths);
+
+	// Called by CowNodes module
+	void Register();
+	void Unregister();
+}
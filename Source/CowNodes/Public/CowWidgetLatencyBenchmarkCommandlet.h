@@ -0,0 +1,50 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CowWidgetLatencyBenchmarkCommandlet.generated.h"
+
+class UUserWidget;
+
+/**
+ * Latency and hitches of CowCreateWidgetAsync
+ *
+ * Runs a headless game world frame by frame (fixed 60 fps, works with -nullrhi) and issues bursts of 1, 10 and 100 requests through:
+ *  - Blueprint: generated Actor Blueprint with CowCreateWidgetAsync node compiled with compact and legacy code generation,
+ *    one harness actor per request of the burst (legacy LoadAsset ignores re-triggers of the same node while it's loading)
+ *  - Native: UCowCreateWidgetAsyncAction used directly
+ *
+ * Scenarios:
+ *  - Warm: widget class is already loaded (generated transient widget Blueprint)
+ *  - Cold: widget class from -ColdWidget=<SoftClassPath> (e.g. /Game/UI/WBP_Menu.WBP_Menu_C) which is unloaded by GC before every burst
+ *
+ * Reports frames and milliseconds from request to WidgetCreated (median and max of the burst),
+ * the worst single frame game thread cost and GC churn (objects left after the burst and time of the forced GC)
+ *
+ * Usage:
+ *	UnrealEditor-Cmd <Project>.uproject -run=CowWidgetLatencyBenchmark -unattended -nullrhi
+ *		[-Bursts=1,10,100] [-Repeats=5] [-ColdWidget=<SoftClassPath>] [-Output=<Path>.csv]
+ *
+ * By default results are written to <Project>/Saved/CowNodes/WidgetLatencyBenchmark.csv
+ */
+UCLASS()
+class COWNODES_API UCowWidgetLatencyBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCowWidgetLatencyBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	// Called by the generated harness Blueprint from OnWidgetCreated
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
+	static void NotifyWidgetCreated(UUserWidget* Widget);
+
+private:
+	// Bound to UCowCreateWidgetAsyncAction::Completed for native requests
+	UFUNCTION()
+	void OnNativeWidgetCreated(UUserWidget* Widget);
+};
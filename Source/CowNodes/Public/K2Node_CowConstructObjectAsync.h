@@ -0,0 +1,91 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_GenericCreateObject.h"
+#include "K2Node_CowConstructObjectAsync.generated.h"
+
+/**
+ * ConstructObjectFromClass without hard-ref to the constructed class
+ *
+ * Same QoL as UK2Node_CowCreateWidgetAsync (see it for the full list) for any class stock ConstructObjectFromClass accepts
+ * (see UGameplayStatics::CanSpawnObjectOfClass), pins are generated by UK2Node_ConstructObjectFromClass from the hidden Class pin
+ *
+ * Expands to UCowConstructObjectAsyncAction -> Set var calls (see FCowCompilerUtilities::GenerateAssignmentNodes)
+ * Unconnected Outer means self, same as stock node
+ *
+ * @note: Known limitations:
+ *		  1. Works only with EventGraph/Macro (because async)
+ *		  2. No support for conflicting names e.g. ExposedVar named "SoftObjectClass" will cause error for node compilation
+ *		  3. Even if soft-ref already loaded you will have 1 frame delay (same as CowCreateWidgetAsync)
+ *		  4. In the editor the node holds hard-ref to the ObjectClass (This is required for pin generation)
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowConstructObjectAsync : public UK2Node_GenericCreateObject
+{
+	GENERATED_BODY()
+public:
+
+	// UK2Node_ConstructObjectFromClass BEGIN
+	virtual bool IsSpawnVarPin(UEdGraphPin* Pin) const override;
+	virtual void CreatePinsForClass(UClass* InClass, TArray<UEdGraphPin*>* OutClassPins = nullptr) override;
+	// UK2Node_ConstructObjectFromClass END
+
+	// Life cycle BEGIN
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+	virtual void PostReconstructNode() override;
+	// Life cycle END
+
+	virtual void AllocateDefaultPins() override;
+	virtual void PinDefaultValueChanged(UEdGraphPin* ChangedPin) override;
+	virtual void PinConnectionListChanged(UEdGraphPin* ChangedPin) override;
+	virtual bool IsCompatibleWithGraph(const UEdGraph* TargetGraph) const override;
+	virtual bool IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const override;
+
+	// COMPILATION BEGIN
+	// UK2Node_GenericCreateObject validates hidden Class pin, we validate the class selected in SoftObjectClass instead
+	virtual void EarlyValidation(FCompilerResultsLog& MessageLog) const override;
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	// COMPILATION END
+
+	virtual FName GetCornerIcon() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FText GetBaseNodeTitle() const override;
+	virtual FText GetNodeTitleFormat() const override;
+
+	// Different helpers
+	void TryCreateOnObjectConstructedPin();
+	void OnSoftObjectClassChanged();
+	// Blueprint->OnChanged bindings are owned by UCowNodesEditorSubsystem (see it for details)
+	void UnbindFromBlueprintChange();
+	bool IsSoftObjectClassConnected() const;
+	UClass* GetSoftClassToSpawn() const;
+	UEdGraphPin* GetSoftObjectPin() const;
+	FORCEINLINE static TArray<FName, TInlineAllocator<3>> GetInternalPinNames()
+	{
+		return { ObjectClass, SoftObjectClass, ObjectConstructed };
+	}
+
+#if WITH_EDITORONLY_DATA
+	// Used only in editor time to generate pins correctly
+	UPROPERTY()
+	TObjectPtr<UClass> ObjectClassToSpawn;
+#endif
+
+	// This node pins
+	static inline const FName ObjectClass = TEXT("Class");
+	static inline const FName ObjectConstructed = TEXT("ObjectConstructed");
+	static inline const FName SoftObjectClass = TEXT("SoftObjectClass");
+
+	// UK2Node_ConstructObjectFromClass
+	static inline const FName Construct_InputOuter = TEXT("Outer");
+
+	// UCowConstructObjectAsyncAction::CowConstructObjectAsync
+	static inline const FName Action_InputObjectClassName = TEXT("ObjectClass");
+	static inline const FName Action_InputOuterName = TEXT("Outer");
+	static inline const FName Action_OutputCompletedName = TEXT("Completed");
+	static inline const FName Action_OutputObjectName = TEXT("Object");
+};
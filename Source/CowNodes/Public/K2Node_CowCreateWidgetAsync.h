@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Editor/UMGEditor/Private/Nodes/K2Node_CreateWidget.h"
+#include "CowAsyncLoadQueue.h"
 #include "K2Node_CowCreateWidgetAsync.generated.h"
 
 /** 
@@ -27,7 +28,14 @@
  *	- Fixed FKismetCompilerUtilities::GenerateAssignmentNodes create hard-ref through DynamicCast for native properties with BlueprintSetter
  *		See FCowCompilerUtilities::GenerateAssignmentNodes for implementation details
  * 
- * For implementation details see ExpandNode (but shortly it replaces the node with LoadAsset -> Cast to UUserWidget -> Set var calls)
+ * For implementation details see ExpandNode (but shortly it replaces the node with UCowCreateWidgetAsyncAction -> Set var calls)
+ * Legacy expansion (LoadAsset -> Cast to UUserWidget -> Set var calls) is still available, see UCowNodesSettings::bCompactCodeGeneration
+ *
+ * LoadPriority (details panel) tells HUD from menu preloads, see ECowLoadPriority. LoadAsset has no priority, so legacy expansion ignores it
+ *
+ * Re-triggering the node while the class is still loading is ignored in both, only one widget is created:
+ *  - compact: UCowCreateWidgetAsyncAction drops requests of the same (self, NodeGuid) while one is pending
+ *  - legacy: LoadAsset latent action is keyed by the node
  * 
  * @note: Known limitations:
  *		  1. Works only with EventGraph/Macro (because async)
@@ -50,6 +58,7 @@ public:
 	virtual void PostLoad() override;
 	virtual void BeginDestroy() override;
 	virtual void PostReconstructNode() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	// Life cycle END
 
 	virtual void AllocateDefaultPins() override;
@@ -61,6 +70,11 @@ public:
 	// COMPILATION BEGIN
 	
 	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+
+	// UCowCreateWidgetAsyncAction -> assignments (see UCowNodesSettings::bCompactCodeGeneration)
+	void ExpandNodeCompact(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph);
+	// LoadAsset -> Conv_ObjectToClass -> UWidgetBlueprintLibrary::Create -> assignments
+	void ExpandNodeLegacy(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph);
 	
 	// If we happen to connect SoftWidgetClass via Link to another pin (meaning at runtime the class may be different)
 	// Give a note for any default values that aren't changed from the base class
@@ -79,10 +93,12 @@ public:
 	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
 	virtual FText GetBaseNodeTitle() const override;
 	virtual FText GetNodeTitleFormat() const override;
+	virtual FText GetTooltipText() const override;
 
 	// Different helpers
 	void TryCreateOnWidgetCreatedPin();
 	void OnSoftWidgetClassChanged();
+	// Blueprint->OnChanged bindings are owned by UCowNodesEditorSubsystem (see it for details)
 	void UnbindFromBlueprintChange();
     bool IsSoftWidgetClassConnected() const;
     UClass* GetClassToSpawn() const;
@@ -105,10 +121,11 @@ public:
 	// Used only in editor time to generate pins correctly
 	UPROPERTY()
 	TObjectPtr<UClass> WidgetClassToSpawn;
-
-	TWeakObjectPtr<class UBlueprint> WeakWidgetClassBlueprint;
-	FDelegateHandle OnWidgetBlueprintChangedHandle;
 #endif
+
+	// Setting rather than a pin, so it can't clash with ExposeOnSpawn variables of the widget
+	UPROPERTY(EditAnywhere, Category = "Loading")
+	ECowLoadPriority LoadPriority = ECowLoadPriority::Gameplay;
 	
 	// This node pins
 	static inline const FName WidgetClass = TEXT("Class");
@@ -124,4 +141,10 @@ public:
 	static inline const FName Create_InputWorldContextObject = TEXT("WorldContextObject");
 	static inline const FName Create_InputWidgetType = TEXT("WidgetType");
 	static inline const FName Create_InputOwningPlayer = TEXT("OwningPlayer");
+
+	// UCowCreateWidgetAsyncAction::CowCreateWidgetAsync (WorldContextObject and OwningPlayer are the same as in Create)
+	static inline const FName Action_InputWidgetClassName = TEXT("WidgetClass");
+	static inline const FName Action_InputPriorityName = TEXT("Priority");
+	static inline const FName Action_OutputCompletedName = TEXT("Completed");
+	static inline const FName Action_OutputWidgetName = TEXT("Widget");
 };
@@ -15,6 +15,9 @@ class UGraphNodeContextMenuContext;
  * GetAllActors of class with no hard-ref and return array type promotion to the native class
  *
  * Use Convert to Multi/Single version using context menu
+ *
+ * Also a base for other "all objects of soft class" queries (see UK2Node_CowGetAllComponentsOfClass):
+ * class and output pins, target function and base class are virtual, every other input pin is passed to the function by name
  */
 UCLASS()
 class COWNODES_API UK2Node_CowGetAllActorsOfClass : public UK2Node
@@ -40,10 +43,19 @@ public:
 
 	// COMPILATION BEGIN
 	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	// Used only with compact code generation (see UCowNodesSettings::bCompactCodeGeneration), otherwise node is expanded
+	virtual class FNodeHandlingFunctor* CreateNodeHandler(class FKismetCompilerContext& CompilerContext) const override;
 	// COMPILATION END
 
 	// Different helpers
-	const FName GetOutPinName() const;
+	virtual FName GetOutPinName() const;
+	virtual FName GetClassPinName() const { return ActorClassName; }
+	// Class pin accepts soft classes of BaseClass, output is BaseClass until the class is selected
+	virtual UClass* GetBaseClass() const;
+	// False for queries that have only the array version
+	virtual bool SupportsSingleOutput() const { return true; }
+	// UCowFunctionLibrary function the node calls (params are named the same as the node pins, except for NodeGuid)
+	virtual UFunction* GetTargetFunction() const;
 	void OnActorClassChanged();
 	UClass* GetNativeClassFromInput() const;
 	void ToggleNodeOutput();
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_CowGetAllActorsOfClass.h"
+#include "K2Node_CowGetAllActorsOfClassInShape.generated.h"
+
+/**
+ * CowGetAllActorsOfClass filtered by a sphere, box, cone or camera frustum natively, with return array type promotion to the native class
+ *
+ * Replacement for GetAllActorsOfClass -> ForEach -> GetActorLocation -> distance/dot checks, which is per actor Blueprint math,
+ * see UCowFunctionLibrary::CowGetAllActorsOfClassInShape for the cost. There is no single version
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowGetAllActorsOfClassInShape : public UK2Node_CowGetAllActorsOfClass
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+
+	virtual void AllocateDefaultPins() override;
+
+	virtual bool SupportsSingleOutput() const override { return false; }
+	virtual UFunction* GetTargetFunction() const override;
+
+	// This node pins
+	static inline const FName ShapeName = TEXT("Shape");
+};
@@ -0,0 +1,33 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_CowGetAllActorsOfClass.h"
+#include "K2Node_CowGetAllComponentsOfClass.generated.h"
+
+/**
+ * All registered components of soft class in the world, with return array type promotion to the native class
+ *
+ * Replacement for GetAllActorsOfClass(Actor) -> GetComponentsByClass, which touches every actor in the world,
+ * see UCowFunctionLibrary::CowGetAllComponentsOfClass for the cost. There is no single version
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowGetAllComponentsOfClass : public UK2Node_CowGetAllActorsOfClass
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+
+	virtual FName GetOutPinName() const override { return OutComponentsName; }
+	virtual FName GetClassPinName() const override { return ComponentClassName; }
+	virtual UClass* GetBaseClass() const override;
+	virtual bool SupportsSingleOutput() const override { return false; }
+	virtual UFunction* GetTargetFunction() const override;
+
+	// This node pins
+	static inline const FName ComponentClassName = TEXT("ComponentClass");
+	static inline const FName OutComponentsName = TEXT("OutComponents");
+};
@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_CowGetAllActorsOfClass.h"
+#include "K2Node_CowGetAllWidgetsOfClass.generated.h"
+
+/**
+ * GetAllWidgetsOfClass with no hard-ref and return array type promotion to the native class
+ *
+ * Stock version walks every UUserWidget in memory, this one only instances of the selected class
+ * (see UCowFunctionLibrary::CowGetAllWidgetsOfClass). There is no single version
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowGetAllWidgetsOfClass : public UK2Node_CowGetAllActorsOfClass
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetMenuCategory() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+
+	virtual void AllocateDefaultPins() override;
+
+	virtual FName GetOutPinName() const override { return FoundWidgetsName; }
+	virtual FName GetClassPinName() const override { return WidgetClassName; }
+	virtual UClass* GetBaseClass() const override;
+	virtual bool SupportsSingleOutput() const override { return false; }
+	virtual UFunction* GetTargetFunction() const override;
+
+	// This node pins (named as UWidgetBlueprintLibrary::GetAllWidgetsOfClass params)
+	static inline const FName WidgetClassName = TEXT("WidgetClass");
+	static inline const FName FoundWidgetsName = TEXT("FoundWidgets");
+	static inline const FName TopLevelOnlyName = TEXT("TopLevelOnly");
+};
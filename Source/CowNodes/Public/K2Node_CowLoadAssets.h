@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_CowLoadAssets.generated.h"
+
+/**
+ * Loads an array of soft object or soft class references with a single streamable request
+ *
+ * Replacement for LoadAsset chains and LoadAsset in a loop (every LoadAsset is a separate request completed on its own tick)
+ *  - Assets pin is a wildcard array which takes its type from the linked array of soft object/soft class references
+ *  - Loaded is an array of objects/classes in the same order as Assets (None for failed or empty entries)
+ *		its type is promoted to the first native class of the element type (see FCowCompilerUtilities::GetFirstNativeClass)
+ *  - Priority is FStreamableManager priority (0 is default, 100 is AsyncLoadHighPriority)
+ *  - OnProgress is executed every time the request makes progress with Progress in [0, 1]
+ *
+ * Expands to UCowLoadAssetsAsyncAction or UCowLoadClassesAsyncAction depending on Assets type
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowLoadAssets : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UK2Node Interface
+	virtual FText GetMenuCategory() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FName GetCornerIcon() const override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual bool IsCompatibleWithGraph(const UEdGraph* TargetGraph) const override;
+	virtual bool IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const override;
+	//~ End UK2Node Interface.
+
+	virtual void AllocateDefaultPins() override;
+	virtual void PostReconstructNode() override;
+	virtual void PinConnectionListChanged(UEdGraphPin* ChangedPin) override;
+
+	// COMPILATION BEGIN
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	// COMPILATION END
+
+	// Different helpers
+	// Assets and Loaded pins take their types from the link of Assets (or become wildcards again)
+	void RefreshPinTypes();
+	bool IsLoadingClasses() const;
+	static bool IsSoftReferenceArray(const FEdGraphPinType& PinType);
+
+	// This node pins
+	static inline const FName AssetsName = TEXT("Assets");
+	static inline const FName PriorityName = TEXT("Priority");
+	static inline const FName OnProgressName = TEXT("OnProgress");
+	static inline const FName ProgressName = TEXT("Progress");
+	static inline const FName CompletedName = TEXT("Completed");
+	static inline const FName LoadedName = TEXT("Loaded");
+
+	// UCowLoadAssetsAsyncAction/UCowLoadClassesAsyncAction (OnProgress, Progress, Completed and Priority are the same as the node pins)
+	static inline const FName Action_InputAssetsName = TEXT("Assets");
+	static inline const FName Action_InputSoftClassesName = TEXT("SoftClasses");
+	static inline const FName Action_OutputObjectsName = TEXT("Objects");
+	static inline const FName Action_OutputClassesName = TEXT("Classes");
+};
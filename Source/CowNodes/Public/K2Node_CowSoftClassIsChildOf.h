@@ -0,0 +1,40 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_CowSoftClassIsChildOf.generated.h"
+
+/**
+ * ClassIsChildOf for soft classes, neither of them is loaded (at runtime too)
+ *
+ * Answer comes from FCowClassAncestry which reads parents of unloaded Blueprint classes from asset registry tags,
+ * so asking "is this enemy class a boss" doesn't pull the boss Blueprint (and everything it references) into memory
+ *
+ * Expands to UCowFunctionLibrary::CowSoftClassIsChildOf
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowSoftClassIsChildOf : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UK2Node Interface
+	virtual FText GetMenuCategory() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual bool IsNodePure() const override { return true; }
+	//~ End UK2Node Interface.
+
+	virtual void AllocateDefaultPins() override;
+
+	// COMPILATION BEGIN
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	// COMPILATION END
+
+	// This node pins (same as UCowFunctionLibrary::CowSoftClassIsChildOf params)
+	static inline const FName ClassName = TEXT("Class");
+	static inline const FName ParentClassName = TEXT("ParentClass");
+};
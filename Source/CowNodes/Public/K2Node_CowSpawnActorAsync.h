@@ -0,0 +1,108 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "K2Node_CowSpawnActorAsync.generated.h"
+
+/**
+ * SpawnActorFromClass without hard-ref to the spawned class
+ *
+ * Same QoL as UK2Node_CowCreateWidgetAsync (see it for the full list), shortly:
+ *  - Takes soft actor class, the class is loaded asynchronously at runtime
+ *  - Shows ExposedOnSpawn parameters of the selected class and picks up new ones automatically
+ *  - Return value is the first native class (or the class of the linked soft class pin, which is a hard-ref anyway)
+ *  - Auto-wiring of ReturnValue uses ActorSpawned instead of Then
+ *
+ * Expands to UCowSpawnActorAsyncAction:
+ *	BeginSpawn (deferred actor) -> Set var calls (see FCowCompilerUtilities::GenerateAssignmentNodes)
+ *	Completed (spawn finished) -> ActorSpawned pin
+ * There is no legacy graph for this node, UCowNodesSettings::bCompactCodeGeneration doesn't affect it
+ *
+ * @note: Known limitations:
+ *		  1. Works only with EventGraph/Macro (because async)
+ *		  2. No support for conflicting names e.g. ExposedVar named "SoftActorClass" will cause error for node compilation
+ *		  3. Even if soft-ref already loaded you will have 1 frame delay (same as CowCreateWidgetAsync)
+ *		  4. In the editor the node holds hard-ref to the ActorClass (This is required for pin generation)
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowSpawnActorAsync : public UK2Node_SpawnActorFromClass
+{
+	GENERATED_BODY()
+public:
+
+	// UK2Node_ConstructObjectFromClass BEGIN
+	virtual bool IsSpawnVarPin(UEdGraphPin* Pin) const override;
+	virtual void CreatePinsForClass(UClass* InClass, TArray<UEdGraphPin*>* OutClassPins = nullptr) override;
+	// UK2Node_ConstructObjectFromClass END
+
+	// Life cycle BEGIN
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+	virtual void PostReconstructNode() override;
+	// Life cycle END
+
+	virtual void AllocateDefaultPins() override;
+	virtual void PinDefaultValueChanged(UEdGraphPin* ChangedPin) override;
+	virtual void PinConnectionListChanged(UEdGraphPin* ChangedPin) override;
+	virtual bool IsCompatibleWithGraph(const UEdGraph* TargetGraph) const override;
+	virtual bool IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const override;
+
+	// COMPILATION BEGIN
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+
+	// Class, name conflicts and hard-ref notes, breaks all links on error
+	bool ValidateExpansion(FKismetCompilerContext& CompilerContext);
+
+	// Spawns async action for Factory and moves everything common for single and batched spawn:
+	// exec/then, soft class, spawn parameters, ReturnValue and assignments of ExposeOnSpawn pins (chained from BeginSpawn)
+	class UK2Node_AsyncAction* ExpandSpawnAction(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UFunction* Factory);
+	// COMPILATION END
+
+	virtual FName GetCornerIcon() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FText GetBaseNodeTitle() const override;
+	virtual FText GetNodeTitleFormat() const override;
+
+	// Different helpers
+	// Output pins that aren't part of UK2Node_SpawnActorFromClass (OnClassPinChanged keeps them)
+	virtual void TryCreateAsyncOutputPins();
+	// ResultClass is the class return pins are promoted to
+	virtual void UpdateResultPinTypes(UClass* ResultClass);
+	void OnSoftActorClassChanged();
+	// Blueprint->OnChanged bindings are owned by UCowNodesEditorSubsystem (see it for details)
+	void UnbindFromBlueprintChange();
+	bool IsSoftActorClassConnected() const;
+	UClass* GetSoftClassToSpawn() const;
+	UEdGraphPin* GetSoftActorPin() const;
+	virtual TArray<FName> GetInternalPinNames() const
+	{
+		return { ActorClass, SoftActorClass, ActorSpawned };
+	}
+
+#if WITH_EDITORONLY_DATA
+	// Used only in editor time to generate pins correctly
+	UPROPERTY()
+	TObjectPtr<UClass> ActorClassToSpawn;
+#endif
+
+	// This node pins
+	static inline const FName ActorClass = TEXT("Class");
+	static inline const FName ActorSpawned = TEXT("ActorSpawned");
+	static inline const FName SoftActorClass = TEXT("SoftActorClass");
+
+	// UK2Node_SpawnActorFromClass pins (helper with names is private to BlueprintGraph)
+	static inline const FName Spawn_InputSpawnTransform = TEXT("SpawnTransform");
+	static inline const FName Spawn_InputCollisionHandlingOverride = TEXT("CollisionHandlingOverride");
+	static inline const FName Spawn_InputTransformScaleMethod = TEXT("TransformScaleMethod");
+	static inline const FName Spawn_InputOwner = TEXT("Owner");
+	static inline const FName Spawn_InputWorldContextObject = TEXT("WorldContextObject");
+
+	// UCowSpawnActorAsyncAction::CowSpawnActorAsync (other inputs have the same names as UK2Node_SpawnActorFromClass pins)
+	static inline const FName Action_InputActorClassName = TEXT("ActorClass");
+	static inline const FName Action_OutputBeginSpawnName = TEXT("BeginSpawn");
+	static inline const FName Action_OutputCompletedName = TEXT("Completed");
+	static inline const FName Action_OutputActorName = TEXT("Actor");
+};
@@ -0,0 +1,54 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node_CowSpawnActorAsync.h"
+#include "K2Node_CowSpawnActorsBatched.generated.h"
+
+/**
+ * CowSpawnActorAsync for many instances of the same class (waves of enemies, props etc.)
+ *
+ * Instead of a single SpawnTransform takes SpawnTransforms array, the class is loaded once and instances are spawned
+ * over several frames within cow.SpawnBatched.FrameBudgetMs (see UCowSpawnActorsBatchedAction)
+ *
+ * Pins on top of CowSpawnActorAsync:
+ *  - ActorSpawned is executed per instance with ReturnValue and SpawnIndex (index in SpawnTransforms)
+ *  - AllSpawned is executed once with SpawnedActors (aligned with SpawnTransforms, nullptr for failed instances)
+ * Pure nodes linked to ExposeOnSpawn pins are evaluated per instance, so per instance data is Get(Array, SpawnIndex)
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowSpawnActorsBatched : public UK2Node_CowSpawnActorAsync
+{
+	GENERATED_BODY()
+public:
+
+	virtual bool IsSpawnVarPin(UEdGraphPin* Pin) const override;
+	virtual void AllocateDefaultPins() override;
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+
+	virtual FText GetTooltipText() const override;
+	virtual FText GetBaseNodeTitle() const override;
+	virtual FText GetNodeTitleFormat() const override;
+
+	virtual void TryCreateAsyncOutputPins() override;
+	virtual void UpdateResultPinTypes(UClass* ResultClass) override;
+	virtual TArray<FName> GetInternalPinNames() const override
+	{
+		TArray<FName> InternalPins = Super::GetInternalPinNames();
+		InternalPins.Append({ SpawnTransforms, AllSpawned, SpawnIndex, SpawnedActors });
+		return InternalPins;
+	}
+
+	// This node pins
+	static inline const FName SpawnTransforms = TEXT("SpawnTransforms");
+	static inline const FName AllSpawned = TEXT("AllSpawned");
+	static inline const FName SpawnIndex = TEXT("SpawnIndex");
+	static inline const FName SpawnedActors = TEXT("SpawnedActors");
+
+	// UCowSpawnActorsBatchedAction::CowSpawnActorsBatched
+	static inline const FName Action_InputSpawnTransformsName = TEXT("SpawnTransforms");
+	static inline const FName Action_OutputSpawnedName = TEXT("Spawned");
+	static inline const FName Action_OutputIndexName = TEXT("Index");
+	static inline const FName Action_OutputActorsName = TEXT("Actors");
+};
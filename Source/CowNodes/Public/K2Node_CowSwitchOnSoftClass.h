@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_CowSwitchOnSoftClass.generated.h"
+
+/**
+ * Switch on soft class, executes the first case Selection is child of (Default if none), no class is loaded
+ *
+ * Cases are edited in the details panel (Pin Classes), order matters: put children before their parents
+ * (compiler warns about cases that can never be reached). Answers come from FCowClassAncestry same as UK2Node_CowSoftClassIsChildOf
+ *
+ * Expands to:
+ *	MakeArray (case classes as literals) -> UCowFunctionLibrary::CowSwitchOnSoftClass -> SwitchInteger (INDEX_NONE goes to Default)
+ */
+UCLASS()
+class COWNODES_API UK2Node_CowSwitchOnSoftClass : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UK2Node Interface
+	virtual FText GetMenuCategory() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual bool ShouldShowNodeProperties() const override { return true; }
+	//~ End UK2Node Interface.
+
+	virtual void AllocateDefaultPins() override;
+	virtual void ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	// COMPILATION BEGIN
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	// COMPILATION END
+
+	// Different helpers
+	// PinClasses without empty entries and duplicates, in order
+	TArray<FSoftObjectPath> GetCasePaths() const;
+	// Case pin is named by the class path (unique, survives reordering), displayed by the class name
+	// Moved/renamed classes and cases edited in place keep their links, see ReallocatePinsDuringReconstruction
+	static FName GetCasePinName(const FSoftObjectPath& CasePath);
+	// Where CasePath points now (core redirects, then redirector of the Blueprint asset), CasePath if it wasn't moved
+	static FSoftObjectPath RedirectCasePath(const FSoftObjectPath& CasePath);
+
+	UPROPERTY(EditAnywhere, Category = PinOptions)
+	TArray<TSoftClassPtr<UObject>> PinClasses;
+
+	// This node pins
+	static inline const FName SelectionName = TEXT("Selection");
+	static inline const FName DefaultName = TEXT("Default");
+
+	// UCowFunctionLibrary::CowSwitchOnSoftClass
+	static inline const FName Function_InputClassName = TEXT("Class");
+	static inline const FName Function_InputCasesName = TEXT("Cases");
+};
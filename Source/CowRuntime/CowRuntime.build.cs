@@ -36,6 +36,8 @@ public class CowRuntime : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"UMG",
+				"AssetRegistry",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,510 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowActorIndexSubsystem.h"
+
+// Engine
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+// Cow
+#include "CowStats.h"
+
+namespace
+{
+	bool GQueryMemoEnable = true;
+	FAutoConsoleVariableRef CVarQueryMemoEnable(
+		TEXT("cow.QueryMemo.Enable"),
+		GQueryMemoEnable,
+		TEXT("Share results of CowGetAllActorsOfClass/CowGetActorOfClass for the same class between callers in the same frame (default: 1)"));
+}
+
+UCowActorIndexSubsystem* UCowActorIndexSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	return World ? World->GetSubsystem<UCowActorIndexSubsystem>() : nullptr;
+}
+
+void UCowActorIndexSubsystem::Deinitialize()
+{
+	if (bBuilt)
+	{
+		UWorld* World = GetWorld();
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		// (sic), that's the engine's name for it
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+		FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+		FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	}
+
+	ensureMsgf(IterationDepth == 0, TEXT("TCowActorView outlived the world"));
+	Buckets.Empty();
+	PendingAdds.Empty();
+	ClassToBucket.Empty();
+	ActorToIndex.Empty();
+	QueryCache.Empty();
+	QueryMemo.Empty();
+	bBuilt = false;
+
+	Super::Deinitialize();
+}
+
+TSharedRef<const TArray<AActor*>> UCowActorIndexSubsystem::FindOrQueryActors(const UClass* Class, ECowActorQuery Query, int32& OutActorsScanned)
+{
+	OutActorsScanned = 0;
+	if (!bBuilt)
+	{
+		Build();
+	}
+
+	if (QueryMemoFrame != GFrameCounter)
+	{
+		FlushQueryMemo();
+		QueryMemoFrame = GFrameCounter;
+	}
+
+	const TPair<TObjectKey<UClass>, ECowActorQuery> Key(Class, Query);
+	if (GQueryMemoEnable)
+	{
+		if (const FMemoizedQuery* Memoized = QueryMemo.Find(Key))
+		{
+			INC_DWORD_STAT(STAT_Cow_QueryMemoHits);
+			return Memoized->Actors;
+		}
+	}
+	INC_DWORD_STAT(STAT_Cow_QueryMemoMisses);
+
+	// Removed actors are nulled while a view iterates, this may be called from inside the loop
+	const bool bFirstOnly = Query == ECowActorQuery::FirstActor;
+	TSharedRef<TArray<AActor*>> Actors = MakeShared<TArray<AActor*>>();
+	for (const int32 BucketIndex : GetClassBuckets(Class))
+	{
+		for (AActor* Actor : Buckets[BucketIndex].Actors)
+		{
+			++OutActorsScanned;
+			if (Actor)
+			{
+				Actors->Add(Actor);
+				if (bFirstOnly)
+				{
+					break;
+				}
+			}
+		}
+		if (bFirstOnly && !Actors->IsEmpty())
+		{
+			break;
+		}
+	}
+
+	// Spawned while a view iterates, not in the buckets yet
+	for (AActor* Actor : PendingAdds)
+	{
+		if (bFirstOnly && !Actors->IsEmpty())
+		{
+			break;
+		}
+		++OutActorsScanned;
+		if (Actor->IsA(Class))
+		{
+			Actors->Add(Actor);
+		}
+	}
+
+	if (GQueryMemoEnable)
+	{
+		QueryMemo.Add(Key, { Class, Actors });
+	}
+	return Actors;
+}
+
+void UCowActorIndexSubsystem::FlushQueryMemo()
+{
+	QueryMemo.Reset();
+}
+
+const TArray<int32, TInlineAllocator<8>>& UCowActorIndexSubsystem::GetClassBuckets(const UClass* Class)
+{
+	if (const TArray<int32, TInlineAllocator<8>>* ClassBuckets = QueryCache.Find(Class))
+	{
+		return *ClassBuckets;
+	}
+
+	TArray<int32, TInlineAllocator<8>>& ClassBuckets = QueryCache.Add(Class);
+	for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+	{
+		if (Buckets[BucketIndex].Class->IsChildOf(Class))
+		{
+			ClassBuckets.Add(BucketIndex);
+		}
+	}
+	return ClassBuckets;
+}
+
+void UCowActorIndexSubsystem::BeginIteration(const UClass* Class, FBucketRanges& OutRanges)
+{
+	if (!bBuilt)
+	{
+		Build();
+	}
+	++IterationDepth;
+
+	const TArray<int32, TInlineAllocator<8>>& ClassBuckets = GetClassBuckets(Class);
+	OutRanges.Reset(ClassBuckets.Num());
+	for (const int32 BucketIndex : ClassBuckets)
+	{
+		OutRanges.Emplace(BucketIndex, Buckets[BucketIndex].Actors.Num());
+	}
+}
+
+void UCowActorIndexSubsystem::EndIteration()
+{
+	check(IterationDepth > 0);
+	if (--IterationDepth > 0)
+	{
+		return;
+	}
+
+	if (bNeedsCompaction)
+	{
+		Compact();
+	}
+
+	// Added after compaction so their indices are final
+	TArray<AActor*> Added = MoveTemp(PendingAdds);
+	PendingAdds.Reset();
+	for (AActor* Actor : Added)
+	{
+		AddActor(Actor);
+	}
+}
+
+void UCowActorIndexSubsystem::RefreshPositions(int32 BucketIndex)
+{
+	FBucket& Bucket = Buckets[BucketIndex];
+	if (Bucket.PositionsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowActorIndexSubsystem::RefreshPositions);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_ActorIndexPositions);
+
+	Bucket.PositionsFrame = GFrameCounter;
+	TArray<int32, TInlineAllocator<16>> Finalized;
+	for (TConstSetBitIterator<> It(Bucket.Refresh); It; ++It)
+	{
+		Bucket.ReadPosition(It.GetIndex());
+		if (FBucket::IsPositionFinal(Bucket.Actors[It.GetIndex()]))
+		{
+			Finalized.Add(It.GetIndex());
+		}
+	}
+	for (const int32 Index : Finalized)
+	{
+		Bucket.Refresh[Index] = false;
+	}
+}
+
+void UCowActorIndexSubsystem::Build()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowActorIndexSubsystem::Build);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_ActorIndexBuild);
+
+	bBuilt = true;
+
+	UWorld* World = GetWorld();
+	for (ULevel* Level : World->GetLevels())
+	{
+		OnLevelAdded(Level, World);
+	}
+
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UCowActorIndexSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UCowActorIndexSubsystem::OnActorDestroyed));
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UCowActorIndexSubsystem::OnLevelAdded);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UCowActorIndexSubsystem::OnLevelRemoved);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UCowActorIndexSubsystem::OnEndFrame);
+}
+
+void UCowActorIndexSubsystem::AddActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->IsActorBeingDestroyed() || ActorToIndex.Contains(Actor))
+	{
+		return;
+	}
+
+	// Bucket arrays must not grow under a view, chunks handed out by ForEachChunk point straight into them
+	if (IterationDepth > 0)
+	{
+		if (!PendingAdds.Contains(Actor))
+		{
+			PendingAdds.Add(Actor);
+			InvalidateQueryMemo(Actor);
+		}
+		return;
+	}
+
+	const UClass* Class = Actor->GetClass();
+	int32 BucketIndex = INDEX_NONE;
+	if (const int32* ExistingBucket = ClassToBucket.Find(Class))
+	{
+		BucketIndex = *ExistingBucket;
+	}
+	else
+	{
+		BucketIndex = Buckets.AddDefaulted();
+		Buckets[BucketIndex].Class = Class;
+		ClassToBucket.Add(Class, BucketIndex);
+		QueryCache.Reset();
+	}
+
+	ActorToIndex.Add(Actor, FActorSlot{ BucketIndex, Buckets[BucketIndex].Add(Actor) });
+	InvalidateQueryMemo(Actor);
+}
+
+void UCowActorIndexSubsystem::RemoveActor(AActor* Actor)
+{
+	FActorSlot Slot;
+	if (!ActorToIndex.RemoveAndCopyValue(Actor, Slot))
+	{
+		if (PendingAdds.RemoveSingleSwap(Actor) > 0)
+		{
+			InvalidateQueryMemo(Actor);
+		}
+		return;
+	}
+	InvalidateQueryMemo(Actor);
+
+	FBucket& Bucket = Buckets[Slot.Bucket];
+	if (IterationDepth > 0)
+	{
+		Bucket.Park(Slot.Index);
+		bNeedsCompaction = true;
+		return;
+	}
+
+	Bucket.RemoveAtSwap(Slot.Index);
+	if (Bucket.Actors.IsValidIndex(Slot.Index))
+	{
+		ActorToIndex[Bucket.Actors[Slot.Index]].Index = Slot.Index;
+	}
+	else if (Bucket.Actors.IsEmpty())
+	{
+		RemoveBucket(Slot.Bucket);
+	}
+}
+
+void UCowActorIndexSubsystem::RemoveBucket(int32 BucketIndex)
+{
+	ClassToBucket.Remove(Buckets[BucketIndex].Class);
+	Buckets.RemoveAtSwap(BucketIndex);
+	if (Buckets.IsValidIndex(BucketIndex))
+	{
+		// Last bucket moved into the hole, its actors point to the old index
+		ClassToBucket[Buckets[BucketIndex].Class] = BucketIndex;
+		for (const AActor* Actor : Buckets[BucketIndex].Actors)
+		{
+			if (Actor)
+			{
+				ActorToIndex[Actor].Bucket = BucketIndex;
+			}
+		}
+	}
+	QueryCache.Reset();
+}
+
+void UCowActorIndexSubsystem::Compact()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowActorIndexSubsystem::Compact);
+
+	bNeedsCompaction = false;
+	for (int32 BucketIndex = Buckets.Num() - 1; BucketIndex >= 0; --BucketIndex)
+	{
+		FBucket& Bucket = Buckets[BucketIndex];
+		if (!Bucket.Compact())
+		{
+			continue;
+		}
+
+		const TArray<AActor*>& Actors = Bucket.Actors;
+		if (Actors.IsEmpty())
+		{
+			RemoveBucket(BucketIndex);
+			continue;
+		}
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
+		{
+			ActorToIndex[Actors[Index]].Index = Index;
+		}
+	}
+}
+
+void UCowActorIndexSubsystem::InvalidateQueryMemo(const AActor* Actor)
+{
+	// Only results Actor belongs to are affected, memo holds a handful of classes so a walk is fine
+	for (auto It = QueryMemo.CreateIterator(); It; ++It)
+	{
+		if (Actor->IsA(It.Value().Class))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UCowActorIndexSubsystem::OnActorSpawned(AActor* Actor)
+{
+	AddActor(Actor);
+}
+
+void UCowActorIndexSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	RemoveActor(Actor);
+}
+
+void UCowActorIndexSubsystem::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld() || !Level)
+	{
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		AddActor(Actor);
+	}
+}
+
+void UCowActorIndexSubsystem::OnEndFrame()
+{
+	FlushQueryMemo();
+}
+
+void UCowActorIndexSubsystem::OnLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// Null level means all levels are being removed
+	if (!Level)
+	{
+		for (ULevel* WorldLevel : World->GetLevels())
+		{
+			OnLevelRemoved(WorldLevel, World);
+		}
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			RemoveActor(Actor);
+		}
+	}
+}
+
+int32 UCowActorIndexSubsystem::FBucket::Add(AActor* Actor)
+{
+	const int32 Index = Actors.Add(Actor);
+	X.AddUninitialized();
+	Y.AddUninitialized();
+	Z.AddUninitialized();
+	Radius.AddUninitialized();
+
+	// Deferred spawns are added from OnActorSpawned before FinishSpawning, a Blueprint root (components panel) doesn't exist yet
+	// and the spawn transform may still change, so anything not final is re-read until it is
+	Refresh.Add(!IsPositionFinal(Actor));
+	ReadPosition(Index);
+	return Index;
+}
+
+void UCowActorIndexSubsystem::FBucket::RemoveAtSwap(int32 Index)
+{
+	Actors.RemoveAtSwap(Index);
+	X.RemoveAtSwap(Index);
+	Y.RemoveAtSwap(Index);
+	Z.RemoveAtSwap(Index);
+	Radius.RemoveAtSwap(Index);
+	Refresh.RemoveAtSwap(Index);
+}
+
+void UCowActorIndexSubsystem::FBucket::Park(int32 Index)
+{
+	Actors[Index] = nullptr;
+	X[Index] = UnplacedCoordinate;
+	Y[Index] = UnplacedCoordinate;
+	Z[Index] = UnplacedCoordinate;
+	Radius[Index] = Cow::Kernels::UnplacedRadius;
+	Refresh[Index] = false;
+}
+
+bool UCowActorIndexSubsystem::FBucket::Compact()
+{
+	int32 NewNum = 0;
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
+	{
+		if (!Actors[Index])
+		{
+			continue;
+		}
+		if (NewNum != Index)
+		{
+			Actors[NewNum] = Actors[Index];
+			X[NewNum] = X[Index];
+			Y[NewNum] = Y[Index];
+			Z[NewNum] = Z[Index];
+			Radius[NewNum] = Radius[Index];
+			Refresh[NewNum] = Refresh[Index];
+		}
+		++NewNum;
+	}
+
+	if (NewNum == Actors.Num())
+	{
+		return false;
+	}
+
+	const int32 NumRemoved = Actors.Num() - NewNum;
+	Actors.SetNum(NewNum);
+	X.SetNum(NewNum);
+	Y.SetNum(NewNum);
+	Z.SetNum(NewNum);
+	Radius.SetNum(NewNum);
+	Refresh.RemoveAt(NewNum, NumRemoved);
+	return true;
+}
+
+bool UCowActorIndexSubsystem::FBucket::IsPositionFinal(const AActor* Actor)
+{
+	const USceneComponent* Root = Actor ? Actor->GetRootComponent() : nullptr;
+	return Root && Root->Mobility == EComponentMobility::Static && Actor->IsActorInitialized();
+}
+
+void UCowActorIndexSubsystem::FBucket::ReadPosition(int32 Index)
+{
+	const AActor* Actor = Actors[Index];
+	const USceneComponent* Root = Actor ? Actor->GetRootComponent() : nullptr;
+	if (!Root)
+	{
+		X[Index] = UnplacedCoordinate;
+		Y[Index] = UnplacedCoordinate;
+		Z[Index] = UnplacedCoordinate;
+		Radius[Index] = Cow::Kernels::UnplacedRadius;
+		return;
+	}
+
+	// Bounds aren't always centered on the location, radius is grown so the sphere around the location still contains them
+	const FVector Location = Root->GetComponentLocation();
+	const FBoxSphereBounds& Bounds = Root->Bounds;
+	X[Index] = static_cast<float>(Location.X);
+	Y[Index] = static_cast<float>(Location.Y);
+	Z[Index] = static_cast<float>(Location.Z);
+	Radius[Index] = static_cast<float>(Bounds.SphereRadius + FVector::Dist(Bounds.Origin, Location));
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowAllocationCounter.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	// Counter of the current thread, nullptr outside of FScopedAllocationCounter
+	thread_local Cow::FAllocationCount* GCowThreadAllocationCount = nullptr;
+
+	// Forwards everything to the wrapped allocator and counts allocations of threads that have a counter
+	class FCowCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCowCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->Malloc(Size, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->TryMalloc(Size, Alignment);
+		}
+
+		virtual void* MallocZeroed(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->MallocZeroed(Size, Alignment);
+		}
+
+		virtual void* TryMallocZeroed(SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->TryMallocZeroed(Size, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->Realloc(Original, Size, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			Count(Size);
+			return InnerMalloc->TryRealloc(Original, Size, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Size, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		virtual void OnMallocInitialized() override { InnerMalloc->OnMallocInitialized(); }
+		virtual void OnPreFork() override { InnerMalloc->OnPreFork(); }
+		virtual void OnPostFork() override { InnerMalloc->OnPostFork(); }
+
+	private:
+		FORCEINLINE static void Count(SIZE_T Size)
+		{
+			if (Cow::FAllocationCount* Counter = GCowThreadAllocationCount)
+			{
+				++Counter->Allocations;
+				Counter->Bytes += Size;
+			}
+		}
+
+		FMalloc* InnerMalloc;
+	};
+
+	// Installed once, nullptr if GMalloc couldn't be wrapped
+	FCowCountingMalloc* GetCountingMalloc()
+	{
+		static FCowCountingMalloc* CountingMalloc = []() -> FCowCountingMalloc*
+		{
+			FMalloc* InnerMalloc = GMalloc;
+			if (!InnerMalloc)
+			{
+				return nullptr;
+			}
+
+			// FMalloc is allocated by the system allocator (FUseSystemMallocForNew), not by the one it wraps
+			FCowCountingMalloc* Proxy = new FCowCountingMalloc(InnerMalloc);
+			if (FPlatformAtomics::InterlockedCompareExchangePointer(reinterpret_cast<void**>(&GMalloc), Proxy, InnerMalloc) != InnerMalloc)
+			{
+				delete Proxy;
+				return nullptr;
+			}
+			return Proxy;
+		}();
+		return CountingMalloc;
+	}
+}
+
+Cow::FScopedAllocationCounter::FScopedAllocationCounter(FAllocationCount& InResult)
+{
+	if (GetCountingMalloc())
+	{
+		Previous = GCowThreadAllocationCount;
+		GCowThreadAllocationCount = &InResult;
+	}
+}
+
+Cow::FScopedAllocationCounter::~FScopedAllocationCounter()
+{
+	if (GetCountingMalloc())
+	{
+		GCowThreadAllocationCount = Previous;
+	}
+}
+
+bool Cow::FScopedAllocationCounter::IsAvailable()
+{
+	return GetCountingMalloc() != nullptr;
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,284 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowAsync.h"
+
+// Engine
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+// Cow
+#include "CowStats.h"
+#include "CowTrace.h"
+
+namespace
+{
+	// TSoftClassPtr<T>::Get() check, soft class may point to anything
+	UClass* ResolveClass(const FSoftObjectPath& ClassPath, const UClass* BaseClass)
+	{
+		UClass* Class = Cast<UClass>(ClassPath.ResolveObject());
+		return Class && Class->IsChildOf(BaseClass) ? Class : nullptr;
+	}
+}
+
+namespace Cow
+{
+	FAsyncRequestState::~FAsyncRequestState()
+	{
+		// Load queue was shut down with the request still pending, nothing may wait forever
+		for (TPromise<UObject*>& Promise : Promises)
+		{
+			Promise.SetValue(nullptr);
+		}
+	}
+
+	void FAsyncRequestState::Cancel()
+	{
+		if (!bPending)
+		{
+			return;
+		}
+		bPending = false;
+		bCancelled = true;
+
+		if (FCowAsyncLoadQueue* LoadQueue = FCowAsyncLoadQueue::TryGet())
+		{
+			LoadQueue->Cancel(LoadRequestId);
+		}
+		if (OnCancelled)
+		{
+			OnCancelled();
+			OnCancelled.Reset();
+		}
+
+		Callbacks.Reset();
+		TArray<TPromise<UObject*>> PendingPromises = MoveTemp(Promises);
+		for (TPromise<UObject*>& Promise : PendingPromises)
+		{
+			Promise.SetValue(nullptr);
+		}
+	}
+
+	void FAsyncRequestState::AddCallback(FCallback Callback)
+	{
+		if (bPending)
+		{
+			Callbacks.Add(MoveTemp(Callback));
+		}
+		else if (!bCancelled)
+		{
+			Callback(Result.Get());
+		}
+	}
+
+	TFuture<UObject*> FAsyncRequestState::GetFuture()
+	{
+		if (!bPending)
+		{
+			return MakeFulfilledPromise<UObject*>(Result.Get()).GetFuture();
+		}
+		return Promises.AddDefaulted_GetRef().GetFuture();
+	}
+
+	void FAsyncRequestState::Start(const FSoftObjectPath& ClassPath, FCowAsyncLoadQueue::FOnLoaded OnLoaded, ECowLoadPriority Priority)
+	{
+		LoadRequestId = FCowAsyncLoadQueue::Get().Request(ClassPath, MoveTemp(OnLoaded), Priority);
+	}
+
+	void FAsyncRequestState::Complete(UObject* InResult)
+	{
+		if (!bPending)
+		{
+			return;
+		}
+		bPending = false;
+		Result = InResult;
+		OnCancelled.Reset();
+
+		// Callbacks may add more callbacks or cancel other requests
+		TArray<FCallback> PendingCallbacks = MoveTemp(Callbacks);
+		TArray<TPromise<UObject*>> PendingPromises = MoveTemp(Promises);
+		for (FCallback& Callback : PendingCallbacks)
+		{
+			Callback(InResult);
+		}
+		for (TPromise<UObject*>& Promise : PendingPromises)
+		{
+			Promise.SetValue(InResult);
+		}
+	}
+}
+
+TSharedRef<Cow::FAsyncRequestState> Cow::Private::CreateWidgetAsync(UObject* Owner, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+	TFunction<void(UObject&)> InitFn, APlayerController* OwningPlayer, ECowLoadPriority Priority)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Cow::CreateWidgetAsync);
+
+	TSharedRef<FAsyncRequestState> State = MakeShared<FAsyncRequestState>();
+	TSharedRef<FWidgetRequestTracker> Tracker = MakeShared<FWidgetRequestTracker>();
+	Tracker->Start(FGuid(), Owner, ClassPath);
+
+	TWeakObjectPtr<UObject> WeakOwner = Owner;
+	State->OnCancelled = [Tracker]()
+	{
+		Tracker->Cancel();
+	};
+
+	State->Start(ClassPath, [State, Tracker, WeakOwner, WeakPlayer = TWeakObjectPtr<APlayerController>(OwningPlayer), ClassPath, BaseClass, InitFn = MoveTemp(InitFn)]()
+	{
+		UObject* Context = WeakOwner.Get();
+		if (!Context)
+		{
+			State->Cancel();
+			return;
+		}
+
+		UUserWidget* Widget = Tracker->Create(Context, ResolveClass(ClassPath, BaseClass), WeakPlayer.Get());
+		if (Widget && InitFn)
+		{
+			InitFn(*Widget);
+		}
+		State->Complete(Widget);
+	}, Priority);
+	return State;
+}
+
+TSharedRef<Cow::FAsyncRequestState> Cow::Private::SpawnActorAsync(UObject* WorldContextObject, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+	const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params, TFunction<void(UObject&)> InitFn, ECowLoadPriority Priority)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Cow::SpawnActorAsync);
+
+	TSharedRef<FAsyncRequestState> State = MakeShared<FAsyncRequestState>();
+	State->Start(ClassPath, [State, WeakContext = TWeakObjectPtr<UObject>(WorldContextObject), WeakOwner = TWeakObjectPtr<AActor>(Params.Owner),
+		ClassPath, BaseClass, SpawnTransform, Params, InitFn = MoveTemp(InitFn), RequestCycle = FPlatformTime::Cycles64()]() mutable
+	{
+		UObject* Context = WeakContext.Get();
+		if (!Context)
+		{
+			State->Cancel();
+			return;
+		}
+
+		// Owner could be destroyed while the class was loading, spawn without it like a null Owner pin
+		Params.Owner = WeakOwner.Get();
+
+		AActor* Actor = BeginSpawnActor(Context, ResolveClass(ClassPath, BaseClass), SpawnTransform, Params);
+		if (Actor)
+		{
+			if (InitFn)
+			{
+				InitFn(*Actor);
+			}
+			Actor = FinishSpawnActor(Actor, SpawnTransform, Params);
+		}
+
+		// Zero GUID, same as the call site stats of Cow:: requests
+		TRACE_COW_ASYNC_REQUEST(FGuid(), ClassPath, RequestCycle, FPlatformTime::Cycles64(), Actor ? 1 : 0);
+		State->Complete(Actor);
+	}, Priority);
+	return State;
+}
+
+TSharedRef<Cow::FAsyncRequestState> Cow::Private::ConstructObjectAsync(UObject* Outer, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+	TFunction<void(UObject&)> InitFn, ECowLoadPriority Priority)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Cow::ConstructObjectAsync);
+
+	TSharedRef<FAsyncRequestState> State = MakeShared<FAsyncRequestState>();
+	State->Start(ClassPath, [State, WeakOuter = TWeakObjectPtr<UObject>(Outer), ClassPath, BaseClass, InitFn = MoveTemp(InitFn), RequestCycle = FPlatformTime::Cycles64()]()
+	{
+		UObject* OuterObject = WeakOuter.Get();
+		if (!OuterObject)
+		{
+			State->Cancel();
+			return;
+		}
+
+		UObject* Object = ConstructObject(ResolveClass(ClassPath, BaseClass), OuterObject);
+		if (Object && InitFn)
+		{
+			InitFn(*Object);
+		}
+
+		TRACE_COW_ASYNC_REQUEST(FGuid(), ClassPath, RequestCycle, FPlatformTime::Cycles64(), Object ? 1 : 0);
+		State->Complete(Object);
+	}, Priority);
+	return State;
+}
+
+void Cow::Private::FWidgetRequestTracker::Start(const FGuid& InNodeGuid, const UObject* Caller, const FSoftObjectPath& InClassPath)
+{
+	NodeGuid = InNodeGuid;
+	ClassPath = InClassPath;
+	CallerClass = Caller ? Caller->GetClass() : nullptr;
+	RequestCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT(STAT_Cow_PendingWidgetLoads);
+	COW_STATS_RECORD_WIDGET_REQUEST(NodeGuid, CallerClass.Get());
+
+	if (!ClassPath.IsNull())
+	{
+		TRACE_COW_WIDGET_LOAD_START(NodeGuid, ClassPath);
+	}
+}
+
+UUserWidget* Cow::Private::FWidgetRequestTracker::Create(UObject* Context, UClass* Class, APlayerController* OwningPlayer)
+{
+	if (!ClassPath.IsNull())
+	{
+		TRACE_COW_WIDGET_LOAD_END(NodeGuid, ClassPath, Class != nullptr);
+	}
+
+	UUserWidget* Widget = nullptr;
+	[[maybe_unused]] const uint64 CreateStartCycle = FPlatformTime::Cycles64();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Cow_CreateWidget);
+		Widget = UWidgetBlueprintLibrary::Create(Context, Class, OwningPlayer);
+	}
+	[[maybe_unused]] const uint64 CreateEndCycle = FPlatformTime::Cycles64();
+	TRACE_COW_WIDGET_CREATE(NodeGuid, ClassPath, CreateStartCycle, CreateEndCycle);
+
+	DEC_DWORD_STAT(STAT_Cow_PendingWidgetLoads);
+	COW_STATS_RECORD_WIDGET_COMPLETED(NodeGuid, CallerClass.Get(), CreateEndCycle - RequestCycle, CreateEndCycle - CreateStartCycle);
+	RequestCycle = 0;
+	return Widget;
+}
+
+void Cow::Private::FWidgetRequestTracker::Cancel()
+{
+	if (RequestCycle != 0)
+	{
+		DEC_DWORD_STAT(STAT_Cow_PendingWidgetLoads);
+		COW_STATS_RECORD_WIDGET_CANCELLED(NodeGuid, CallerClass.Get());
+		RequestCycle = 0;
+	}
+}
+
+AActor* Cow::Private::BeginSpawnActor(UObject* Context, UClass* Class, const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params)
+{
+	if (!Class)
+	{
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_Cow_SpawnActor);
+	return UGameplayStatics::BeginDeferredActorSpawnFromClass(Context, Class, SpawnTransform, Params.CollisionHandlingOverride, Params.Owner, Params.TransformScaleMethod);
+}
+
+AActor* Cow::Private::FinishSpawnActor(AActor* Actor, const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Cow_SpawnActor);
+	return UGameplayStatics::FinishSpawningActor(Actor, SpawnTransform, Params.TransformScaleMethod);
+}
+
+UObject* Cow::Private::ConstructObject(UClass* Class, UObject* Outer)
+{
+	if (!Class)
+	{
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_Cow_ConstructObject);
+	return UGameplayStatics::SpawnObject(Class, Outer);
+}
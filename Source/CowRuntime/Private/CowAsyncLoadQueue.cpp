@@ -0,0 +1,294 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowAsyncLoadQueue.h"
+
+// Engine
+#include "Engine/AssetManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+// Cow
+#include "CowStats.h"
+
+namespace
+{
+	TUniquePtr<FCowAsyncLoadQueue> GCowAsyncLoadQueue;
+
+	float GBackgroundPauseFrameMs = 0.f;
+	FAutoConsoleVariableRef CVarBackgroundPauseFrameMs(
+		TEXT("cow.LoadQueue.BackgroundPauseFrameMs"),
+		GBackgroundPauseFrameMs,
+		TEXT("Background loads aren't requested (and what they loaded isn't created) while the last frame took longer than this, 0 never pauses (default: 0)"));
+
+	bool IsBackgroundPaused()
+	{
+		return GBackgroundPauseFrameMs > 0.f && FApp::GetDeltaTime() * 1000.0 > GBackgroundPauseFrameMs;
+	}
+}
+
+FCowAsyncLoadQueue& FCowAsyncLoadQueue::Get()
+{
+	if (!GCowAsyncLoadQueue)
+	{
+		GCowAsyncLoadQueue.Reset(new FCowAsyncLoadQueue());
+	}
+	return *GCowAsyncLoadQueue;
+}
+
+FCowAsyncLoadQueue* FCowAsyncLoadQueue::TryGet()
+{
+	return GCowAsyncLoadQueue.Get();
+}
+
+void FCowAsyncLoadQueue::Shutdown()
+{
+	GCowAsyncLoadQueue.Reset();
+}
+
+int32 FCowAsyncLoadQueue::GetStreamablePriority(ECowLoadPriority Priority)
+{
+	switch (Priority)
+	{
+		case ECowLoadPriority::Critical:
+			return FStreamableManager::AsyncLoadHighPriority;
+		case ECowLoadPriority::Background:
+			return FStreamableManager::DefaultAsyncLoadPriority - FStreamableManager::AsyncLoadHighPriority;
+		default:
+			return FStreamableManager::DefaultAsyncLoadPriority;
+	}
+}
+
+FCowAsyncLoadQueue::~FCowAsyncLoadQueue()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(DeferredTickHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(BackgroundTickHandle);
+
+	for (auto& [Path, Load] : PendingLoads)
+	{
+		for (const TSharedPtr<FStreamableHandle>& Handle : Load.Handles)
+		{
+			Handle->CancelHandle();
+		}
+	}
+	SET_DWORD_STAT(STAT_Cow_PendingClassLoads, 0);
+	SET_DWORD_STAT(STAT_Cow_HeldBackgroundLoads, 0);
+}
+
+FCowAsyncLoadQueue::FRequestId FCowAsyncLoadQueue::Request(const FSoftObjectPath& Path, FOnLoaded OnLoaded, ECowLoadPriority Priority)
+{
+	check(IsInGameThread());
+
+	const FRequestId RequestId = NextRequestId++;
+	RequestToPath.Add(RequestId, Path);
+
+	// Waiter goes in before the load is requested, streamable manager may complete synchronously (e.g. forced sync loads)
+	if (FPendingLoad* Existing = PendingLoads.Find(Path))
+	{
+		Existing->Waiters.Add({ RequestId, MoveTemp(OnLoaded), Priority });
+		INC_DWORD_STAT(STAT_Cow_CoalescedClassLoads);
+
+		// Held load is requested right away, one in flight is requested again with the higher priority
+		// (deferred one completes on the next tick anyway)
+		if (Priority < Existing->Priority)
+		{
+			Existing->Priority = Priority;
+			const bool bWasHeld = HeldPaths.Remove(Path) > 0;
+			if (bWasHeld || !Existing->Handles.IsEmpty())
+			{
+				StartLoad(Path, Priority);
+			}
+			UpdateBackgroundStat();
+		}
+		return RequestId;
+	}
+
+	FPendingLoad& Load = PendingLoads.Add(Path);
+	Load.Waiters.Add({ RequestId, MoveTemp(OnLoaded), Priority });
+	Load.Priority = Priority;
+	INC_DWORD_STAT(STAT_Cow_PendingClassLoads);
+
+	if (Priority == ECowLoadPriority::Background && IsBackgroundPaused())
+	{
+		HeldPaths.Add(Path);
+		StartBackgroundTicker();
+		UpdateBackgroundStat();
+	}
+	else
+	{
+		StartLoad(Path, Priority);
+	}
+	return RequestId;
+}
+
+void FCowAsyncLoadQueue::Cancel(FRequestId RequestId)
+{
+	check(IsInGameThread());
+
+	FSoftObjectPath Path;
+	if (!RequestToPath.RemoveAndCopyValue(RequestId, Path))
+	{
+		return;
+	}
+
+	// Class is loaded already, waiter is in the post-load queue
+	if (PostLoadQueue.RemoveAll([RequestId](const FWaiter& Waiter) { return Waiter.RequestId == RequestId; }) > 0)
+	{
+		UpdateBackgroundStat();
+		return;
+	}
+
+	// Not found if waiters of the path are being called right now, OnLoaded skips the cancelled ones
+	FPendingLoad* Load = PendingLoads.Find(Path);
+	if (!Load)
+	{
+		return;
+	}
+
+	Load->Waiters.RemoveAll([RequestId](const FWaiter& Waiter) { return Waiter.RequestId == RequestId; });
+	if (Load->Waiters.IsEmpty())
+	{
+		// Nobody waits for it anymore, streamable manager drops the load if nothing else requested it
+		for (const TSharedPtr<FStreamableHandle>& Handle : Load->Handles)
+		{
+			Handle->CancelHandle();
+		}
+		PendingLoads.Remove(Path);
+		HeldPaths.Remove(Path);
+		DEC_DWORD_STAT(STAT_Cow_PendingClassLoads);
+		UpdateBackgroundStat();
+	}
+}
+
+void FCowAsyncLoadQueue::StartLoad(const FSoftObjectPath& Path, ECowLoadPriority Priority)
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	if (!Path.IsNull())
+	{
+		Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateRaw(this, &FCowAsyncLoadQueue::OnLoaded, Path), GetStreamablePriority(Priority));
+	}
+
+	// Already completed if the load was synchronous
+	FPendingLoad* Load = PendingLoads.Find(Path);
+	if (!Load)
+	{
+		return;
+	}
+
+	if (Handle.IsValid())
+	{
+		Load->Handles.Add(MoveTemp(Handle));
+	}
+	else if (Load->Handles.IsEmpty())
+	{
+		DeferredPaths.AddUnique(Path);
+		if (!DeferredTickHandle.IsValid())
+		{
+			DeferredTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCowAsyncLoadQueue::CompleteDeferred));
+		}
+	}
+}
+
+void FCowAsyncLoadQueue::OnLoaded(FSoftObjectPath Path)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCowAsyncLoadQueue::OnLoaded);
+
+	// Removed first, waiters may request the same path again and that's a new load
+	FPendingLoad Load;
+	if (!PendingLoads.RemoveAndCopyValue(Path, Load))
+	{
+		return;
+	}
+	DEC_DWORD_STAT(STAT_Cow_PendingClassLoads);
+
+	for (FWaiter& Waiter : Load.Waiters)
+	{
+		// Earlier waiter may have cancelled this one
+		if (!RequestToPath.Contains(Waiter.RequestId))
+		{
+			continue;
+		}
+
+		if (Waiter.Priority == ECowLoadPriority::Background)
+		{
+			Waiter.Handle = Load.Handles.IsEmpty() ? nullptr : Load.Handles[0];
+			PostLoadQueue.Add(MoveTemp(Waiter));
+			continue;
+		}
+
+		RequestToPath.Remove(Waiter.RequestId);
+		Waiter.OnLoaded();
+	}
+
+	if (!PostLoadQueue.IsEmpty())
+	{
+		StartBackgroundTicker();
+		UpdateBackgroundStat();
+	}
+}
+
+bool FCowAsyncLoadQueue::CompleteDeferred(float DeltaTime)
+{
+	DeferredTickHandle.Reset();
+
+	TArray<FSoftObjectPath> Paths = MoveTemp(DeferredPaths);
+	DeferredPaths.Reset();
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		OnLoaded(Path);
+	}
+
+	// One shot ticker
+	return false;
+}
+
+bool FCowAsyncLoadQueue::TickBackground(float DeltaTime)
+{
+	if (!IsBackgroundPaused())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCowAsyncLoadQueue::TickBackground);
+
+		// Waiters may request more background loads, those wait for the next tick
+		TArray<FSoftObjectPath> Paths = MoveTemp(HeldPaths);
+		HeldPaths.Reset();
+		TArray<FWaiter> Waiters = MoveTemp(PostLoadQueue);
+		PostLoadQueue.Reset();
+
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			if (const FPendingLoad* Load = PendingLoads.Find(Path))
+			{
+				StartLoad(Path, Load->Priority);
+			}
+		}
+
+		for (FWaiter& Waiter : Waiters)
+		{
+			// Earlier waiter may have cancelled this one
+			if (RequestToPath.Remove(Waiter.RequestId) > 0)
+			{
+				Waiter.OnLoaded();
+			}
+		}
+		UpdateBackgroundStat();
+	}
+
+	if (HeldPaths.IsEmpty() && PostLoadQueue.IsEmpty())
+	{
+		BackgroundTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FCowAsyncLoadQueue::StartBackgroundTicker()
+{
+	if (!BackgroundTickHandle.IsValid())
+	{
+		BackgroundTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCowAsyncLoadQueue::TickBackground));
+	}
+}
+
+void FCowAsyncLoadQueue::UpdateBackgroundStat() const
+{
+	SET_DWORD_STAT(STAT_Cow_HeldBackgroundLoads, HeldPaths.Num() + PostLoadQueue.Num());
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowClassAncestry.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/BlueprintSupport.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	TUniquePtr<FCowClassAncestry> GCowClassAncestry;
+}
+
+FCowClassAncestry& FCowClassAncestry::Get()
+{
+	if (!GCowClassAncestry)
+	{
+		GCowClassAncestry.Reset(new FCowClassAncestry());
+	}
+	return *GCowClassAncestry;
+}
+
+void FCowClassAncestry::Shutdown()
+{
+	GCowClassAncestry.Reset();
+}
+
+FCowClassAncestry::FCowClassAncestry()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FCowClassAncestry::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FCowClassAncestry::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FCowClassAncestry::OnAssetRenamed);
+	OnFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FCowClassAncestry::InvalidateAll);
+#if WITH_EDITOR
+	// Recompiled (or reparented) Blueprint class is reinstanced, loaded classes may have a new parent now
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FCowClassAncestry::OnObjectsReplaced);
+#endif
+}
+
+FCowClassAncestry::~FCowClassAncestry()
+{
+	// Asset registry could be already unloaded on shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(OnFilesLoadedHandle);
+	}
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+#endif
+}
+
+bool FCowClassAncestry::IsChildOf(const FSoftObjectPath& ClassPath, const FSoftObjectPath& ParentClassPath)
+{
+	if (ClassPath.IsNull() || ParentClassPath.IsNull())
+	{
+		return false;
+	}
+
+	if (ClassPath == ParentClassPath)
+	{
+		return true;
+	}
+
+	// Loading a class loads all of its parents, so unloaded parent of loaded class is simply not a parent
+	if (const UClass* LoadedClass = Cast<UClass>(ClassPath.ResolveObject()))
+	{
+		const UClass* LoadedParentClass = Cast<UClass>(ParentClassPath.ResolveObject());
+		return LoadedParentClass && LoadedClass->IsChildOf(LoadedParentClass);
+	}
+
+	return FindFirstParent(ClassPath, MakeArrayView(&ParentClassPath, 1)) == 0;
+}
+
+int32 FCowClassAncestry::FindFirstParent(const FSoftObjectPath& ClassPath, TConstArrayView<FSoftObjectPath> Candidates)
+{
+	if (ClassPath.IsNull() || Candidates.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	FAncestry Ancestry;
+	GetAncestry(ClassPath, Ancestry);
+
+	// Every parent of the class is in the table now, so candidate that isn't there can't be a parent
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		const int32* Entry = PathToEntry.Find(Candidates[Index]);
+		if (Entry && Ancestry.Contains(*Entry))
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FCowClassAncestry::InvalidateAll()
+{
+	Paths.Reset();
+	Parents.Reset();
+	PathToEntry.Reset();
+}
+
+int32 FCowClassAncestry::FindOrAddEntry(const FSoftObjectPath& ClassPath)
+{
+	if (const int32* Existing = PathToEntry.Find(ClassPath))
+	{
+		return *Existing;
+	}
+
+	// Walk up until we meet a class that is already in the table (every class is added before its parent is resolved,
+	// so broken tags that point back to a child can't make us loop)
+	int32 FirstEntry = INDEX_NONE;
+	int32 ChildEntry = INDEX_NONE;
+	FSoftObjectPath Path = ClassPath;
+	while (!Path.IsNull())
+	{
+		if (const int32* Existing = PathToEntry.Find(Path))
+		{
+			Parents[ChildEntry] = *Existing;
+			break;
+		}
+
+		FSoftObjectPath ParentPath;
+		if (!ResolveParentClassPath(Path, ParentPath))
+		{
+			// Child (if any) stays UnresolvedParent and is retried by GetAncestry
+			break;
+		}
+
+		const int32 Entry = Paths.Add(Path);
+		Parents.Add(ParentPath.IsNull() ? INDEX_NONE : UnresolvedParent);
+		PathToEntry.Add(Path, Entry);
+
+		if (ChildEntry == INDEX_NONE)
+		{
+			FirstEntry = Entry;
+		}
+		else
+		{
+			Parents[ChildEntry] = Entry;
+		}
+		ChildEntry = Entry;
+		Path = ParentPath;
+	}
+	return FirstEntry;
+}
+
+void FCowClassAncestry::GetAncestry(const FSoftObjectPath& ClassPath, FAncestry& OutEntries)
+{
+	int32 Entry = FindOrAddEntry(ClassPath);
+	// Chain can't be longer than the table, otherwise tags are cyclic
+	while (Entry != INDEX_NONE && OutEntries.Num() < Paths.Num())
+	{
+		OutEntries.Add(Entry);
+
+		if (Parents[Entry] == UnresolvedParent)
+		{
+			RetryParent(Entry);
+		}
+		Entry = Parents[Entry] == UnresolvedParent ? INDEX_NONE : Parents[Entry];
+	}
+}
+
+void FCowClassAncestry::RetryParent(int32 Entry)
+{
+	// Costs an asset registry lookup per question until the parent is discovered, which is expected to happen only during initial scan
+	FSoftObjectPath ParentPath;
+	if (ResolveParentClassPath(Paths[Entry], ParentPath) && !ParentPath.IsNull())
+	{
+		const int32 ParentEntry = FindOrAddEntry(ParentPath);
+		if (ParentEntry != INDEX_NONE)
+		{
+			Parents[Entry] = ParentEntry;
+		}
+	}
+}
+
+bool FCowClassAncestry::ResolveParentClassPath(const FSoftObjectPath& ClassPath, FSoftObjectPath& OutParentPath)
+{
+	OutParentPath.Reset();
+
+	// Loaded classes (natives included) know their parent, no reason to touch asset registry
+	if (const UClass* LoadedClass = Cast<UClass>(ClassPath.ResolveObject()))
+	{
+		if (const UClass* SuperClass = LoadedClass->GetSuperClass())
+		{
+			OutParentPath = FSoftObjectPath(SuperClass);
+		}
+		return true;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	FAssetData AssetData;
+	if (AssetRegistry.TryGetAssetByObjectPath(ClassPath, AssetData) != UE::AssetRegistry::EExists::Exists)
+	{
+		// Soft class points to the generated class (BP_Foo_C) while editor registry knows only the Blueprint (BP_Foo)
+		FString BlueprintName = ClassPath.GetAssetName();
+		if (!BlueprintName.RemoveFromEnd(TEXT("_C")))
+		{
+			return false;
+		}
+		const FSoftObjectPath BlueprintPath(FTopLevelAssetPath(ClassPath.GetLongPackageFName(), FName(*BlueprintName)));
+		if (AssetRegistry.TryGetAssetByObjectPath(BlueprintPath, AssetData) != UE::AssetRegistry::EExists::Exists)
+		{
+			return false;
+		}
+	}
+
+	FString ParentClassPath;
+	if (!AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath))
+	{
+		// Skips Blueprint parents in between, but still better than nothing
+		AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassPath);
+	}
+	if (ParentClassPath.IsEmpty())
+	{
+		return false;
+	}
+
+	// Tags are stored as export text (/Script/Engine.BlueprintGeneratedClass'/Game/BP_Base.BP_Base_C')
+	OutParentPath = FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(ParentClassPath));
+	return !OutParentPath.IsNull();
+}
+
+void FCowClassAncestry::OnAssetAdded(const FAssetData& AssetData)
+{
+	InvalidateAll();
+}
+
+void FCowClassAncestry::OnAssetRemoved(const FAssetData& AssetData)
+{
+	InvalidateAll();
+}
+
+void FCowClassAncestry::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	InvalidateAll();
+}
+
+#if WITH_EDITOR
+void FCowClassAncestry::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	InvalidateAll();
+}
+#endif
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowConstructObjectAsyncAction.h"
+
+// Engine
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// Cow
+#include "CowAsync.h"
+#include "CowTrace.h"
+
+UCowConstructObjectAsyncAction* UCowConstructObjectAsyncAction::CowConstructObjectAsync(UObject* WorldContextObject, TSoftClassPtr<UObject> ObjectClass, UObject* Outer, FGuid NodeGuid)
+{
+	UCowConstructObjectAsyncAction* Action = NewObject<UCowConstructObjectAsyncAction>();
+	Action->WorldContextObject = WorldContextObject;
+	Action->ObjectClass = ObjectClass;
+	Action->Outer = Outer ? Outer : WorldContextObject;
+	Action->NodeGuid = NodeGuid;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UCowConstructObjectAsyncAction::Activate()
+{
+	RequestCycle = FPlatformTime::Cycles64();
+
+	if (ObjectClass.IsNull())
+	{
+		// Keep LoadAsset behaviour: completion (with nullptr) is never executed in the same frame
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull))
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowConstructObjectAsyncAction::OnObjectClassLoaded));
+		}
+		else
+		{
+			SetReadyToDestroy();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowConstructObjectAsyncAction::RequestLoad);
+
+	// Load queue executes the callback on the next tick even if the class is already loaded (same 1 frame delay LoadAsset has)
+	LoadRequestId = FCowAsyncLoadQueue::Get().Request(ObjectClass.ToSoftObjectPath(), [WeakThis = TWeakObjectPtr<UCowConstructObjectAsyncAction>(this)]()
+	{
+		if (UCowConstructObjectAsyncAction* This = WeakThis.Get())
+		{
+			This->OnObjectClassLoaded();
+		}
+	});
+}
+
+void UCowConstructObjectAsyncAction::OnObjectClassLoaded()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowConstructObjectAsyncAction::OnObjectClassLoaded);
+
+	LoadRequestId = 0;
+
+	// Caller or outer is gone, same as latent LoadAsset we simply never complete
+	UObject* OuterObject = Outer.Get();
+	if (!WorldContextObject.IsValid() || !OuterObject)
+	{
+		SetReadyToDestroy();
+		return;
+	}
+
+	UObject* Object = Cow::Private::ConstructObject(ObjectClass.Get(), OuterObject);
+	TRACE_COW_ASYNC_REQUEST(NodeGuid, ObjectClass.ToSoftObjectPath(), RequestCycle, FPlatformTime::Cycles64(), Object ? 1 : 0);
+	Completed.Broadcast(Object);
+
+	SetReadyToDestroy();
+}
+
+void UCowConstructObjectAsyncAction::BeginDestroy()
+{
+	// Destroyed before completion, nobody else may need the class anymore
+	if (FCowAsyncLoadQueue* LoadQueue = FCowAsyncLoadQueue::TryGet())
+	{
+		LoadQueue->Cancel(LoadRequestId);
+	}
+	LoadRequestId = 0;
+
+	Super::BeginDestroy();
+}
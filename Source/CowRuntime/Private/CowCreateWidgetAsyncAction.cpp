@@ -0,0 +1,136 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowCreateWidgetAsyncAction.h"
+
+// Engine
+#include "Blueprint/UserWidget.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// (WorldContextObject, NodeGuid) of requests in flight, latent LoadAsset keyed its action the same way (callback target, node UUID)
+	TSet<TPair<FObjectKey, FGuid>> GPendingNodeRequests;
+}
+
+UCowCreateWidgetAsyncAction* UCowCreateWidgetAsyncAction::CowCreateWidgetAsync(UObject* WorldContextObject, TSoftClassPtr<UUserWidget> WidgetClass, APlayerController* OwningPlayer, FGuid NodeGuid, ECowLoadPriority Priority)
+{
+	UCowCreateWidgetAsyncAction* Action = NewObject<UCowCreateWidgetAsyncAction>();
+	Action->WorldContextObject = WorldContextObject;
+	Action->WidgetClass = WidgetClass;
+	Action->OwningPlayer = OwningPlayer;
+	Action->Priority = Priority;
+	Action->NodeGuid = NodeGuid;
+
+	// Without a game instance nothing references the action while the class loads and it would be collected mid-load
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr)
+	{
+		Action->RegisterWithGameInstance(GameInstance);
+	}
+	else
+	{
+		Action->AddToRoot();
+	}
+	return Action;
+}
+
+void UCowCreateWidgetAsyncAction::Activate()
+{
+	// Node executed again while its widget is loading, dropped like LoadAsset does (C++ callers without NodeGuid are never dropped)
+	if (NodeGuid.IsValid())
+	{
+		bool bAlreadyPending = false;
+		PendingOwner = FObjectKey(WorldContextObject.Get());
+		GPendingNodeRequests.Add({ PendingOwner, NodeGuid }, &bAlreadyPending);
+		if (bAlreadyPending)
+		{
+			Finish();
+			return;
+		}
+		bPendingForNode = true;
+	}
+
+	Tracker.Start(NodeGuid, WorldContextObject.Get(), WidgetClass.ToSoftObjectPath());
+
+	if (WidgetClass.IsNull())
+	{
+		// Keep LoadAsset behaviour: completion (with nullptr) is never executed in the same frame
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull))
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowCreateWidgetAsyncAction::OnWidgetClassLoaded));
+		}
+		else
+		{
+			Finish();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowCreateWidgetAsyncAction::RequestLoad);
+
+	// Load queue executes the callback on the next tick even if the class is already loaded (same 1 frame delay LoadAsset has)
+	LoadRequestId = FCowAsyncLoadQueue::Get().Request(WidgetClass.ToSoftObjectPath(), [WeakThis = TWeakObjectPtr<UCowCreateWidgetAsyncAction>(this)]()
+	{
+		if (UCowCreateWidgetAsyncAction* This = WeakThis.Get())
+		{
+			This->OnWidgetClassLoaded();
+		}
+	}, Priority);
+}
+
+void UCowCreateWidgetAsyncAction::OnWidgetClassLoaded()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowCreateWidgetAsyncAction::OnWidgetClassLoaded);
+
+	LoadRequestId = 0;
+
+	// Owner is gone, same as latent LoadAsset we simply never complete
+	UObject* Context = WorldContextObject.Get();
+	if (!Context)
+	{
+		Finish();
+		return;
+	}
+
+	// Released before the broadcast, the node may be executed again from Completed
+	Finish();
+
+	UUserWidget* Widget = Tracker.Create(Context, WidgetClass.Get(), OwningPlayer.Get());
+	Completed.Broadcast(Widget);
+}
+
+void UCowCreateWidgetAsyncAction::Finish()
+{
+	ReleasePendingForNode();
+	if (IsRooted())
+	{
+		RemoveFromRoot();
+	}
+	SetReadyToDestroy();
+}
+
+void UCowCreateWidgetAsyncAction::BeginDestroy()
+{
+	// Destroyed before completion (e.g. owner is gone or game instance shut down)
+	if (FCowAsyncLoadQueue* LoadQueue = FCowAsyncLoadQueue::TryGet())
+	{
+		LoadQueue->Cancel(LoadRequestId);
+	}
+	LoadRequestId = 0;
+	Tracker.Cancel();
+	ReleasePendingForNode();
+
+	Super::BeginDestroy();
+}
+
+void UCowCreateWidgetAsyncAction::ReleasePendingForNode()
+{
+	if (bPendingForNode)
+	{
+		GPendingNodeRequests.Remove({ PendingOwner, NodeGuid });
+		bPendingForNode = false;
+	}
+}
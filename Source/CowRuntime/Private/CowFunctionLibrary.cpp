@@ -2,18 +2,40 @@
 
 #include "CowFunctionLibrary.h"
 #include "EngineUtils.h"
+#include "Blueprint/UserWidget.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "UObject/UObjectHash.h"
+#include "CowStats.h"
+#include "CowTrace.h"
+#include "CowClassAncestry.h"
+#include "CowActorIndexSubsystem.h"
 
-void UCowFunctionLibrary::CowGetAllActorsOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, TArray<AActor*>& OutActors)
+void UCowFunctionLibrary::CowGetAllActorsOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, TArray<AActor*>& OutActors, FGuid NodeGuid)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowFunctionLibrary::CowGetAllActorsOfClass);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_GetAllActorsOfClass);
+	[[maybe_unused]] const uint64 StartCycle = FPlatformTime::Cycles64();
+	[[maybe_unused]] int32 ActorsScanned = 0;
+
 	OutActors.Reset();
 
 	// By doing hard mental exercise we were able to deduce that if soft ptr isn't loaded no actors present in world :Einstein:
 	if (UClass* LoadedClass = ActorClass.Get())
 	{
-		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+		if (UCowActorIndexSubsystem* ActorIndex = UCowActorIndexSubsystem::Get(WorldContextObject))
+		{
+			// Same frame callers share the result, the copy into the Blueprint array keeps its capacity
+			OutActors.Append(*ActorIndex->FindOrQueryActors(LoadedClass, ECowActorQuery::AllActors, ActorsScanned));
+		}
+		// No index in editor preview and inactive worlds
+		else if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
 		{
 			for (TActorIterator<AActor> It{World, LoadedClass}; It; ++It)
 			{
+				++ActorsScanned;
 				if (AActor* Actor = *It; Actor)
 				{
 					OutActors.Add(Actor);
@@ -21,23 +43,193 @@ void UCowFunctionLibrary::CowGetAllActorsOfClass(const UObject* WorldContextObje
 			}
 		}
 	}
+
+	[[maybe_unused]] const uint64 EndCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_ActorsScanned, ActorsScanned);
+	INC_DWORD_STAT_BY(STAT_Cow_QueryOutputBytes, OutActors.GetAllocatedSize());
+	TRACE_COW_ACTOR_QUERY(NodeGuid, ActorClass.ToSoftObjectPath(), StartCycle, EndCycle, ActorsScanned, OutActors.Num());
+	COW_STATS_RECORD_ACTOR_QUERY(ECowCallSiteKind::GetAllActorsOfClass, NodeGuid, WorldContextObject, EndCycle - StartCycle, ActorsScanned);
 }
 
-void UCowFunctionLibrary::CowGetActorOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, AActor*& OutActor)
+void UCowFunctionLibrary::CowGetActorOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, AActor*& OutActor, FGuid NodeGuid)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowFunctionLibrary::CowGetActorOfClass);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_GetActorOfClass);
+	[[maybe_unused]] const uint64 StartCycle = FPlatformTime::Cycles64();
+	[[maybe_unused]] int32 ActorsScanned = 0;
+
+	// Written only if an actor is found, a miss leaves OutActor untouched like it always did
+	AActor* FoundActor = nullptr;
+
 	// By doing hard mental exercise we were able to deduce that if soft ptr isn't loaded no actors present in world :Einstein:
 	if (UClass* LoadedClass = ActorClass.Get())
 	{
-		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+		if (UCowActorIndexSubsystem* ActorIndex = UCowActorIndexSubsystem::Get(WorldContextObject))
+		{
+			const TSharedRef<const TArray<AActor*>> Actors = ActorIndex->FindOrQueryActors(LoadedClass, ECowActorQuery::FirstActor, ActorsScanned);
+			FoundActor = Actors->IsEmpty() ? nullptr : (*Actors)[0];
+		}
+		// No index in editor preview and inactive worlds
+		else if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
 		{
 			for (TActorIterator<AActor> It{World, LoadedClass}; It; ++It)
 			{
+				++ActorsScanned;
 				if (AActor* Actor = *It; Actor)
 				{
-					OutActor = Actor;
-					return;
+					FoundActor = Actor;
+					break;
 				}
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	if (FoundActor)
+	{
+		OutActor = FoundActor;
+	}
+
+	[[maybe_unused]] const uint64 EndCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_ActorsScanned, ActorsScanned);
+	TRACE_COW_ACTOR_QUERY(NodeGuid, ActorClass.ToSoftObjectPath(), StartCycle, EndCycle, ActorsScanned, FoundActor ? 1 : 0);
+	COW_STATS_RECORD_ACTOR_QUERY(ECowCallSiteKind::GetActorOfClass, NodeGuid, WorldContextObject, EndCycle - StartCycle, ActorsScanned);
+}
+
+void UCowFunctionLibrary::CowGetAllActorsOfClassInShape(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const FCowQueryShape& Shape, TArray<AActor*>& OutActors, FGuid NodeGuid)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowFunctionLibrary::CowGetAllActorsOfClassInShape);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_GetAllActorsOfClassInShape);
+	[[maybe_unused]] const uint64 StartCycle = FPlatformTime::Cycles64();
+	[[maybe_unused]] int32 ActorsScanned = 0;
+
+	OutActors.Reset();
+
+	auto CollectInside = [WorldContextObject, &ActorClass, &OutActors, &ActorsScanned](const auto& KernelShape)
+	{
+		TCowActorView<AActor> View(WorldContextObject, ActorClass);
+		View.ForEachChunk([&KernelShape, &OutActors, &ActorsScanned](const TCowActorChunk<AActor>& Chunk)
+		{
+			ActorsScanned += Chunk.Num();
+			Cow::Kernels::ForEachInside(Chunk.GetPositions(), KernelShape, [&Chunk, &OutActors](int32 Index)
+			{
+				OutActors.Add(Chunk.Actors[Index]);
+			});
+		});
+	};
+
+	// Same as CowGetAllActorsOfClass, not loaded class has no instances (the view is empty then)
+	switch (Shape.Type)
+	{
+		case ECowQueryShapeType::Sphere:
+			CollectInside(Cow::Kernels::MakeSphere(Shape.Origin, Shape.Radius));
+			break;
+		case ECowQueryShapeType::Box:
+			CollectInside(Cow::Kernels::MakeBox(Shape.Origin, Shape.Extent));
+			break;
+		case ECowQueryShapeType::Cone:
+			CollectInside(Cow::Kernels::MakeCone(Shape.Origin, Shape.Direction, Shape.Radius, Shape.HalfAngleDegrees));
+			break;
+		case ECowQueryShapeType::Frustum:
+		{
+			const APlayerController* Viewer = Shape.Viewer ? Shape.Viewer.Get() : UGameplayStatics::GetPlayerController(WorldContextObject, 0);
+			if (Viewer && Viewer->PlayerCameraManager)
+			{
+				CollectInside(Cow::Kernels::MakeFrustum(Viewer->PlayerCameraManager->GetCameraCacheView()));
+			}
+			break;
+		}
+	}
+
+	[[maybe_unused]] const uint64 EndCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_ActorsScanned, ActorsScanned);
+	INC_DWORD_STAT_BY(STAT_Cow_QueryOutputBytes, OutActors.GetAllocatedSize());
+	TRACE_COW_ACTOR_QUERY(NodeGuid, ActorClass.ToSoftObjectPath(), StartCycle, EndCycle, ActorsScanned, OutActors.Num());
+	COW_STATS_RECORD_ACTOR_QUERY(ECowCallSiteKind::GetAllActorsOfClassInShape, NodeGuid, WorldContextObject, EndCycle - StartCycle, ActorsScanned);
+}
+
+void UCowFunctionLibrary::CowGetAllComponentsOfClass(const UObject* WorldContextObject, TSoftClassPtr<UActorComponent> ComponentClass, TArray<UActorComponent*>& OutComponents, FGuid NodeGuid)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowFunctionLibrary::CowGetAllComponentsOfClass);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_GetAllComponentsOfClass);
+	[[maybe_unused]] const uint64 StartCycle = FPlatformTime::Cycles64();
+	[[maybe_unused]] int32 ComponentsScanned = 0;
+
+	OutComponents.Reset();
+
+	// Same as for actors, not loaded class has no instances
+	if (UClass* LoadedClass = ComponentClass.Get())
+	{
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+		{
+			// Engine has no global register/unregister event to keep an index of registered components on, so this walks the UObject hash
+			// keyed by class (TActorIterator uses it too). Every live instance of the class and its children is still visited, unregistered ones
+			// and ones of other worlds (editor, other PIE instances, preview scenes) included, cost scales with those, not with actors in the world
+			ForEachObjectOfClass(LoadedClass, [World, &OutComponents, &ComponentsScanned](UObject* Object)
+			{
+				++ComponentsScanned;
+				UActorComponent* Component = static_cast<UActorComponent*>(Object);
+				if (Component->GetWorld() == World && Component->IsRegistered())
+				{
+					OutComponents.Add(Component);
+				}
+			}, /*bIncludeDerivedClasses*/ true, RF_ClassDefaultObject | RF_ArchetypeObject, EInternalObjectFlags::Garbage);
+		}
+	}
+
+	[[maybe_unused]] const uint64 EndCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_ActorsScanned, ComponentsScanned);
+	INC_DWORD_STAT_BY(STAT_Cow_QueryOutputBytes, OutComponents.GetAllocatedSize());
+	TRACE_COW_ACTOR_QUERY(NodeGuid, ComponentClass.ToSoftObjectPath(), StartCycle, EndCycle, ComponentsScanned, OutComponents.Num());
+	COW_STATS_RECORD_ACTOR_QUERY(ECowCallSiteKind::GetAllComponentsOfClass, NodeGuid, WorldContextObject, EndCycle - StartCycle, ComponentsScanned);
+}
+
+void UCowFunctionLibrary::CowGetAllWidgetsOfClass(const UObject* WorldContextObject, TSoftClassPtr<UUserWidget> WidgetClass, TArray<UUserWidget*>& FoundWidgets, bool TopLevelOnly, FGuid NodeGuid)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowFunctionLibrary::CowGetAllWidgetsOfClass);
+	SCOPE_CYCLE_COUNTER(STAT_Cow_GetAllWidgetsOfClass);
+	[[maybe_unused]] const uint64 StartCycle = FPlatformTime::Cycles64();
+	[[maybe_unused]] int32 WidgetsScanned = 0;
+
+	FoundWidgets.Reset();
+
+	if (UClass* LoadedClass = WidgetClass.Get())
+	{
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+		{
+			// Same filtering as the stock version, but only instances of the class and its children are visited (see CowGetAllComponentsOfClass)
+			ForEachObjectOfClass(LoadedClass, [World, TopLevelOnly, &FoundWidgets, &WidgetsScanned](UObject* Object)
+			{
+				++WidgetsScanned;
+				UUserWidget* Widget = static_cast<UUserWidget*>(Object);
+				if (Widget->GetWorld() == World && (!TopLevelOnly || Widget->IsInViewport()))
+				{
+					FoundWidgets.Add(Widget);
+				}
+			}, /*bIncludeDerivedClasses*/ true, RF_ClassDefaultObject | RF_ArchetypeObject, EInternalObjectFlags::Garbage);
+		}
+	}
+
+	[[maybe_unused]] const uint64 EndCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_ActorsScanned, WidgetsScanned);
+	INC_DWORD_STAT_BY(STAT_Cow_QueryOutputBytes, FoundWidgets.GetAllocatedSize());
+	TRACE_COW_ACTOR_QUERY(NodeGuid, WidgetClass.ToSoftObjectPath(), StartCycle, EndCycle, WidgetsScanned, FoundWidgets.Num());
+	COW_STATS_RECORD_ACTOR_QUERY(ECowCallSiteKind::GetAllWidgetsOfClass, NodeGuid, WorldContextObject, EndCycle - StartCycle, WidgetsScanned);
+}
+
+bool UCowFunctionLibrary::CowSoftClassIsChildOf(TSoftClassPtr<UObject> Class, TSoftClassPtr<UObject> ParentClass)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Cow_ClassAncestry);
+	return FCowClassAncestry::Get().IsChildOf(Class.ToSoftObjectPath(), ParentClass.ToSoftObjectPath());
+}
+
+int32 UCowFunctionLibrary::CowSwitchOnSoftClass(TSoftClassPtr<UObject> Class, const TArray<TSoftClassPtr<UObject>>& Cases)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Cow_ClassAncestry);
+	TArray<FSoftObjectPath, TInlineAllocator<16>> CasePaths;
+	CasePaths.Reserve(Cases.Num());
+	for (const TSoftClassPtr<UObject>& Case : Cases)
+	{
+		CasePaths.Add(Case.ToSoftObjectPath());
+	}
+	return FCowClassAncestry::Get().FindFirstParent(Class.ToSoftObjectPath(), CasePaths);
+}
@@ -0,0 +1,168 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowLoadAssetsAsyncAction.h"
+
+// Engine
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// Cow
+#include "CowStats.h"
+#include "CowTrace.h"
+
+void UCowLoadAsyncActionBase::Init(UObject* InWorldContextObject, TArray<FSoftObjectPath>&& InPaths, int32 InPriority, const FGuid& InNodeGuid)
+{
+	WorldContextObject = InWorldContextObject;
+	Paths = MoveTemp(InPaths);
+	Priority = InPriority;
+	NodeGuid = InNodeGuid;
+	RegisterWithGameInstance(InWorldContextObject);
+}
+
+void UCowLoadAsyncActionBase::Activate()
+{
+	RequestCycle = FPlatformTime::Cycles64();
+
+	// Paths may repeat (same asset in several slots), streamable manager gets each once
+	TArray<FSoftObjectPath> PathsToLoad;
+	PathsToLoad.Reserve(Paths.Num());
+	TSet<FSoftObjectPath> UniquePaths;
+	UniquePaths.Reserve(Paths.Num());
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (Path.IsNull())
+		{
+			continue;
+		}
+
+		bool bAlreadyAdded = false;
+		UniquePaths.Add(Path, &bAlreadyAdded);
+		if (!bAlreadyAdded)
+		{
+			PathsToLoad.Add(Path);
+		}
+	}
+
+	if (PathsToLoad.IsEmpty())
+	{
+		// Keep LoadAsset behaviour: completion is never executed in the same frame
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull))
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowLoadAsyncActionBase::OnLoadCompleted));
+		}
+		else
+		{
+			SetReadyToDestroy();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowLoadAsyncActionBase::RequestLoad);
+
+	PendingCount = PathsToLoad.Num();
+	INC_DWORD_STAT_BY(STAT_Cow_PendingAssetLoads, PendingCount);
+
+	// Single request for everything, streamable manager executes the delegate on the next tick even if all assets are already loaded
+	LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PathsToLoad), FStreamableDelegate::CreateUObject(this, &UCowLoadAsyncActionBase::OnLoadCompleted), Priority);
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateUObject(this, &UCowLoadAsyncActionBase::OnLoadUpdate));
+	}
+}
+
+void UCowLoadAsyncActionBase::OnLoadUpdate(TSharedRef<FStreamableHandle> Handle)
+{
+	if (WorldContextObject.IsValid())
+	{
+		OnProgress.Broadcast(Handle->GetProgress());
+	}
+}
+
+void UCowLoadAsyncActionBase::OnLoadCompleted()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowLoadAsyncActionBase::OnLoadCompleted);
+
+	LoadHandle.Reset();
+	DEC_DWORD_STAT_BY(STAT_Cow_PendingAssetLoads, PendingCount);
+	PendingCount = 0;
+
+	// Owner is gone, same as latent LoadAsset we simply never complete
+	if (!WorldContextObject.IsValid())
+	{
+		SetReadyToDestroy();
+		return;
+	}
+
+	TArray<UObject*> Objects;
+	Objects.Reserve(Paths.Num());
+	[[maybe_unused]] int32 NumLoaded = 0;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		UObject* Object = Path.ResolveObject();
+		NumLoaded += Object != nullptr;
+		Objects.Add(Object);
+	}
+
+	TRACE_COW_ASYNC_REQUEST(NodeGuid, Paths.IsEmpty() ? FSoftObjectPath() : Paths[0], RequestCycle, FPlatformTime::Cycles64(), NumLoaded);
+	BroadcastCompleted(Objects);
+
+	SetReadyToDestroy();
+}
+
+void UCowLoadAsyncActionBase::BeginDestroy()
+{
+	// Destroyed before completion (e.g. game instance shut down)
+	if (PendingCount != 0)
+	{
+		DEC_DWORD_STAT_BY(STAT_Cow_PendingAssetLoads, PendingCount);
+		PendingCount = 0;
+	}
+
+	Super::BeginDestroy();
+}
+
+UCowLoadAssetsAsyncAction* UCowLoadAssetsAsyncAction::CowLoadAssets(UObject* WorldContextObject, const TArray<TSoftObjectPtr<UObject>>& Assets, int32 Priority, FGuid NodeGuid)
+{
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(Assets.Num());
+	for (const TSoftObjectPtr<UObject>& Asset : Assets)
+	{
+		Paths.Add(Asset.ToSoftObjectPath());
+	}
+
+	UCowLoadAssetsAsyncAction* Action = NewObject<UCowLoadAssetsAsyncAction>();
+	Action->Init(WorldContextObject, MoveTemp(Paths), Priority, NodeGuid);
+	return Action;
+}
+
+void UCowLoadAssetsAsyncAction::BroadcastCompleted(const TArray<UObject*>& Objects)
+{
+	Completed.Broadcast(Objects);
+}
+
+UCowLoadClassesAsyncAction* UCowLoadClassesAsyncAction::CowLoadClasses(UObject* WorldContextObject, const TArray<TSoftClassPtr<UObject>>& SoftClasses, int32 Priority, FGuid NodeGuid)
+{
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(SoftClasses.Num());
+	for (const TSoftClassPtr<UObject>& Class : SoftClasses)
+	{
+		Paths.Add(Class.ToSoftObjectPath());
+	}
+
+	UCowLoadClassesAsyncAction* Action = NewObject<UCowLoadClassesAsyncAction>();
+	Action->Init(WorldContextObject, MoveTemp(Paths), Priority, NodeGuid);
+	return Action;
+}
+
+void UCowLoadClassesAsyncAction::BroadcastCompleted(const TArray<UObject*>& Objects)
+{
+	TArray<UClass*> Classes;
+	Classes.Reserve(Objects.Num());
+	for (UObject* Object : Objects)
+	{
+		Classes.Add(Cast<UClass>(Object));
+	}
+
+	Completed.Broadcast(Classes);
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowPrefetchSubsystem.h"
+
+// Engine
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+// Cow
+#include "CowSoftReferenceManifest.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCowPrefetch, Log, All);
+
+namespace
+{
+	bool GPrefetchOnPreLoadMap = true;
+	FAutoConsoleVariableRef CVarPrefetchOnPreLoadMap(
+		TEXT("cow.Prefetch.OnPreLoadMap"),
+		GPrefetchOnPreLoadMap,
+		TEXT("Prefetch soft references of Cow nodes used by the map when travel to it starts (default: 1)"));
+}
+
+void UCowPrefetchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UCowPrefetchSubsystem::OnPreLoadMap);
+}
+
+void UCowPrefetchSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	PreLoadMapHandle.Reset();
+	ReleasePrefetch();
+
+	Super::Deinitialize();
+}
+
+int32 UCowPrefetchSubsystem::PrefetchMap(const FString& MapName, int32 Priority)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowPrefetchSubsystem::PrefetchMap);
+
+	// PIE travel passes names of duplicated worlds
+	const FString PackageName = UWorld::RemovePIEPrefix(MapName);
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		UE_LOG(LogCowPrefetch, Verbose, TEXT("%s isn't a long package name, nothing to prefetch"), *MapName);
+		return 0;
+	}
+
+	const FName PackageFName(*PackageName);
+	if (PackageFName == PrefetchedMap && PrefetchHandle.IsValid())
+	{
+		return PrefetchHandle->GetRequestedAssets().Num();
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	FCowSoftReferenceManifest::GetSoftReferences(PackageFName, Paths);
+
+	// New request goes first, references shared with the previous map are never released in between
+	TSharedPtr<FStreamableHandle> PreviousHandle = MoveTemp(PrefetchHandle);
+	PrefetchedMap = PackageFName;
+	if (!Paths.IsEmpty())
+	{
+		UE_LOG(LogCowPrefetch, Log, TEXT("Prefetching %d Cow soft references of %s"), Paths.Num(), *PackageName);
+		PrefetchHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), Priority);
+	}
+
+	if (PreviousHandle.IsValid())
+	{
+		PreviousHandle->ReleaseHandle();
+	}
+	return Paths.Num();
+}
+
+void UCowPrefetchSubsystem::ReleasePrefetch()
+{
+	if (PrefetchHandle.IsValid())
+	{
+		PrefetchHandle->ReleaseHandle();
+		PrefetchHandle.Reset();
+	}
+	PrefetchedMap = NAME_None;
+}
+
+void UCowPrefetchSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	if (GPrefetchOnPreLoadMap)
+	{
+		PrefetchMap(MapName);
+	}
+}
@@ -0,0 +1,290 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowQueryKernels.h"
+
+// Engine
+#include "Camera/CameraTypes.h"
+#include "ConvexVolume.h"
+#include "Kismet/GameplayStatics.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	using namespace Cow::Kernels;
+
+	// Test functions used by both versions, Start..Num range so SIMD version can finish its tail with them
+	FORCEINLINE int32 FilterScalar(const FPositions& P, const FSphere& Shape, int32 Start, int32* OutIndices, int32 Count)
+	{
+		const float RadiusSquared = Shape.Radius * Shape.Radius;
+		for (int32 Index = Start; Index < P.Num; ++Index)
+		{
+			const float DX = P.X[Index] - Shape.Center.X;
+			const float DY = P.Y[Index] - Shape.Center.Y;
+			const float DZ = P.Z[Index] - Shape.Center.Z;
+			OutIndices[Count] = Index;
+			Count += DX * DX + DY * DY + DZ * DZ <= RadiusSquared;
+		}
+		return Count;
+	}
+
+	FORCEINLINE int32 FilterScalar(const FPositions& P, const FBox& Shape, int32 Start, int32* OutIndices, int32 Count)
+	{
+		for (int32 Index = Start; Index < P.Num; ++Index)
+		{
+			const float X = P.X[Index];
+			const float Y = P.Y[Index];
+			const float Z = P.Z[Index];
+			OutIndices[Count] = Index;
+			Count += X >= Shape.Min.X && X <= Shape.Max.X && Y >= Shape.Min.Y && Y <= Shape.Max.Y && Z >= Shape.Min.Z && Z <= Shape.Max.Z;
+		}
+		return Count;
+	}
+
+	FORCEINLINE int32 FilterScalar(const FPositions& P, const FCone& Shape, int32 Start, int32* OutIndices, int32 Count)
+	{
+		// Inside if the projection on the axis is within Length and the angle to the axis is within HalfAngle:
+		// Dot >= |V| * Cos, compared squared (which is why Dot >= 0 is checked separately)
+		const float CosSquared = FMath::Square(FMath::Cos(Shape.HalfAngleRadians));
+		for (int32 Index = Start; Index < P.Num; ++Index)
+		{
+			const float VX = P.X[Index] - Shape.Apex.X;
+			const float VY = P.Y[Index] - Shape.Apex.Y;
+			const float VZ = P.Z[Index] - Shape.Apex.Z;
+			const float Dot = VX * Shape.Direction.X + VY * Shape.Direction.Y + VZ * Shape.Direction.Z;
+			const float DistanceSquared = VX * VX + VY * VY + VZ * VZ;
+			OutIndices[Count] = Index;
+			Count += Dot >= 0.f && Dot <= Shape.Length && Dot * Dot >= DistanceSquared * CosSquared;
+		}
+		return Count;
+	}
+
+	FORCEINLINE int32 FilterScalar(const FPositions& P, const FFrustum& Shape, int32 Start, int32* OutIndices, int32 Count)
+	{
+		for (int32 Index = Start; Index < P.Num; ++Index)
+		{
+			bool bInside = true;
+			for (const FPlane4f& Plane : Shape.Planes)
+			{
+				bInside &= Plane.X * P.X[Index] + Plane.Y * P.Y[Index] + Plane.Z * P.Z[Index] - Plane.W <= P.Radius[Index];
+			}
+			OutIndices[Count] = Index;
+			Count += bInside;
+		}
+		return Count;
+	}
+
+	// Appends lanes set in Mask without branches, Count never gets ahead of Base so writes stay within already processed indices
+	FORCEINLINE int32 AppendMask(int32 Mask, int32 Base, int32* OutIndices, int32 Count)
+	{
+		OutIndices[Count] = Base;
+		Count += Mask & 1;
+		OutIndices[Count] = Base + 1;
+		Count += (Mask >> 1) & 1;
+		OutIndices[Count] = Base + 2;
+		Count += (Mask >> 2) & 1;
+		OutIndices[Count] = Base + 3;
+		Count += (Mask >> 3) & 1;
+		return Count;
+	}
+
+	struct FLanes
+	{
+		VectorRegister4Float X;
+		VectorRegister4Float Y;
+		VectorRegister4Float Z;
+
+		FLanes(const FPositions& P, int32 Index)
+			: X(VectorLoad(P.X + Index))
+			, Y(VectorLoad(P.Y + Index))
+			, Z(VectorLoad(P.Z + Index))
+		{
+		}
+	};
+
+	FORCEINLINE VectorRegister4Float Dot3(const VectorRegister4Float& AX, const VectorRegister4Float& AY, const VectorRegister4Float& AZ,
+		const VectorRegister4Float& BX, const VectorRegister4Float& BY, const VectorRegister4Float& BZ)
+	{
+		return VectorMultiplyAdd(AZ, BZ, VectorMultiplyAdd(AY, BY, VectorMultiply(AX, BX)));
+	}
+}
+
+Cow::Kernels::FSphere Cow::Kernels::MakeSphere(const FVector& Center, double Radius)
+{
+	FSphere Shape;
+	Shape.Center = FVector3f(Center);
+	// Unplaced positions stay outside even of a "whole world" sphere
+	Shape.Radius = static_cast<float>(FMath::Clamp(Radius, 0.0, static_cast<double>(UnplacedCoordinate)));
+	return Shape;
+}
+
+Cow::Kernels::FBox Cow::Kernels::MakeBox(const FVector& Center, const FVector& Extent)
+{
+	const FVector Limit(UnplacedCoordinate * 0.5);
+	FBox Shape;
+	Shape.Min = FVector3f((Center - Extent.GetAbs()).BoundToBox(-Limit, Limit));
+	Shape.Max = FVector3f((Center + Extent.GetAbs()).BoundToBox(-Limit, Limit));
+	return Shape;
+}
+
+Cow::Kernels::FCone Cow::Kernels::MakeCone(const FVector& Apex, const FVector& Direction, double Length, double HalfAngleDegrees)
+{
+	FCone Shape;
+	Shape.Apex = FVector3f(Apex);
+	Shape.Direction = FVector3f(Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector));
+	Shape.Length = static_cast<float>(FMath::Clamp(Length, 0.0, static_cast<double>(UnplacedCoordinate * 0.5f)));
+	Shape.HalfAngleRadians = static_cast<float>(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0, 89.9)));
+	return Shape;
+}
+
+Cow::Kernels::FFrustum Cow::Kernels::MakeFrustum(const FConvexVolume& Volume)
+{
+	FFrustum Shape;
+	for (const FPlane& Plane : Volume.Planes)
+	{
+		Shape.Planes.Emplace(Plane);
+	}
+	return Shape;
+}
+
+Cow::Kernels::FFrustum Cow::Kernels::MakeFrustum(const FMinimalViewInfo& View)
+{
+	FMatrix ViewMatrix;
+	FMatrix ProjectionMatrix;
+	FMatrix ViewProjectionMatrix;
+	UGameplayStatics::GetViewProjectionMatrix(View, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+
+	FConvexVolume Volume;
+	GetViewFrustumBounds(Volume, ViewProjectionMatrix, /*bUseNearPlane*/ true);
+	return MakeFrustum(Volume);
+}
+
+int32 Cow::Kernels::Filter(const FPositions& P, const FSphere& Shape, int32* OutIndices)
+{
+	const VectorRegister4Float CenterX = VectorSetFloat1(Shape.Center.X);
+	const VectorRegister4Float CenterY = VectorSetFloat1(Shape.Center.Y);
+	const VectorRegister4Float CenterZ = VectorSetFloat1(Shape.Center.Z);
+	const VectorRegister4Float RadiusSquared = VectorSetFloat1(Shape.Radius * Shape.Radius);
+
+	int32 Count = 0;
+	int32 Index = 0;
+	for (; Index + 4 <= P.Num; Index += 4)
+	{
+		const FLanes Lanes(P, Index);
+		const VectorRegister4Float DX = VectorSubtract(Lanes.X, CenterX);
+		const VectorRegister4Float DY = VectorSubtract(Lanes.Y, CenterY);
+		const VectorRegister4Float DZ = VectorSubtract(Lanes.Z, CenterZ);
+		const VectorRegister4Float DistanceSquared = Dot3(DX, DY, DZ, DX, DY, DZ);
+		Count = AppendMask(VectorMaskBits(VectorCompareGE(RadiusSquared, DistanceSquared)), Index, OutIndices, Count);
+	}
+	return FilterScalar(P, Shape, Index, OutIndices, Count);
+}
+
+int32 Cow::Kernels::Filter(const FPositions& P, const FBox& Shape, int32* OutIndices)
+{
+	const VectorRegister4Float MinX = VectorSetFloat1(Shape.Min.X);
+	const VectorRegister4Float MinY = VectorSetFloat1(Shape.Min.Y);
+	const VectorRegister4Float MinZ = VectorSetFloat1(Shape.Min.Z);
+	const VectorRegister4Float MaxX = VectorSetFloat1(Shape.Max.X);
+	const VectorRegister4Float MaxY = VectorSetFloat1(Shape.Max.Y);
+	const VectorRegister4Float MaxZ = VectorSetFloat1(Shape.Max.Z);
+
+	int32 Count = 0;
+	int32 Index = 0;
+	for (; Index + 4 <= P.Num; Index += 4)
+	{
+		const FLanes Lanes(P, Index);
+		VectorRegister4Float Inside = VectorBitwiseAnd(VectorCompareGE(Lanes.X, MinX), VectorCompareGE(MaxX, Lanes.X));
+		Inside = VectorBitwiseAnd(Inside, VectorBitwiseAnd(VectorCompareGE(Lanes.Y, MinY), VectorCompareGE(MaxY, Lanes.Y)));
+		Inside = VectorBitwiseAnd(Inside, VectorBitwiseAnd(VectorCompareGE(Lanes.Z, MinZ), VectorCompareGE(MaxZ, Lanes.Z)));
+		Count = AppendMask(VectorMaskBits(Inside), Index, OutIndices, Count);
+	}
+	return FilterScalar(P, Shape, Index, OutIndices, Count);
+}
+
+int32 Cow::Kernels::Filter(const FPositions& P, const FCone& Shape, int32* OutIndices)
+{
+	const VectorRegister4Float ApexX = VectorSetFloat1(Shape.Apex.X);
+	const VectorRegister4Float ApexY = VectorSetFloat1(Shape.Apex.Y);
+	const VectorRegister4Float ApexZ = VectorSetFloat1(Shape.Apex.Z);
+	const VectorRegister4Float DirectionX = VectorSetFloat1(Shape.Direction.X);
+	const VectorRegister4Float DirectionY = VectorSetFloat1(Shape.Direction.Y);
+	const VectorRegister4Float DirectionZ = VectorSetFloat1(Shape.Direction.Z);
+	const VectorRegister4Float Length = VectorSetFloat1(Shape.Length);
+	const VectorRegister4Float CosSquared = VectorSetFloat1(FMath::Square(FMath::Cos(Shape.HalfAngleRadians)));
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	int32 Count = 0;
+	int32 Index = 0;
+	for (; Index + 4 <= P.Num; Index += 4)
+	{
+		const FLanes Lanes(P, Index);
+		const VectorRegister4Float VX = VectorSubtract(Lanes.X, ApexX);
+		const VectorRegister4Float VY = VectorSubtract(Lanes.Y, ApexY);
+		const VectorRegister4Float VZ = VectorSubtract(Lanes.Z, ApexZ);
+		const VectorRegister4Float Dot = Dot3(VX, VY, VZ, DirectionX, DirectionY, DirectionZ);
+		const VectorRegister4Float DistanceSquared = Dot3(VX, VY, VZ, VX, VY, VZ);
+
+		VectorRegister4Float Inside = VectorBitwiseAnd(VectorCompareGE(Dot, Zero), VectorCompareGE(Length, Dot));
+		Inside = VectorBitwiseAnd(Inside, VectorCompareGE(VectorMultiply(Dot, Dot), VectorMultiply(DistanceSquared, CosSquared)));
+		Count = AppendMask(VectorMaskBits(Inside), Index, OutIndices, Count);
+	}
+	return FilterScalar(P, Shape, Index, OutIndices, Count);
+}
+
+int32 Cow::Kernels::Filter(const FPositions& P, const FFrustum& Shape, int32* OutIndices)
+{
+	// 6 planes at most for view frustums, anything bigger is fine just slower
+	struct FPlaneLanes
+	{
+		VectorRegister4Float X;
+		VectorRegister4Float Y;
+		VectorRegister4Float Z;
+		VectorRegister4Float W;
+	};
+	TArray<FPlaneLanes, TInlineAllocator<6>> Planes;
+	Planes.Reserve(Shape.Planes.Num());
+	for (const FPlane4f& Plane : Shape.Planes)
+	{
+		Planes.Add({ VectorSetFloat1(Plane.X), VectorSetFloat1(Plane.Y), VectorSetFloat1(Plane.Z), VectorSetFloat1(Plane.W) });
+	}
+
+	int32 Count = 0;
+	int32 Index = 0;
+	if (!Planes.IsEmpty())
+	{
+		for (; Index + 4 <= P.Num; Index += 4)
+		{
+			const FLanes Lanes(P, Index);
+			const VectorRegister4Float Radius = VectorLoad(P.Radius + Index);
+
+			VectorRegister4Float Inside = VectorCompareGE(Radius, VectorSubtract(Dot3(Lanes.X, Lanes.Y, Lanes.Z, Planes[0].X, Planes[0].Y, Planes[0].Z), Planes[0].W));
+			for (int32 PlaneIndex = 1; PlaneIndex < Planes.Num(); ++PlaneIndex)
+			{
+				const FPlaneLanes& Plane = Planes[PlaneIndex];
+				Inside = VectorBitwiseAnd(Inside, VectorCompareGE(Radius, VectorSubtract(Dot3(Lanes.X, Lanes.Y, Lanes.Z, Plane.X, Plane.Y, Plane.Z), Plane.W)));
+			}
+			Count = AppendMask(VectorMaskBits(Inside), Index, OutIndices, Count);
+		}
+	}
+	return FilterScalar(P, Shape, Index, OutIndices, Count);
+}
+
+int32 Cow::Kernels::Scalar::Filter(const FPositions& P, const FSphere& Shape, int32* OutIndices)
+{
+	return FilterScalar(P, Shape, 0, OutIndices, 0);
+}
+
+int32 Cow::Kernels::Scalar::Filter(const FPositions& P, const FBox& Shape, int32* OutIndices)
+{
+	return FilterScalar(P, Shape, 0, OutIndices, 0);
+}
+
+int32 Cow::Kernels::Scalar::Filter(const FPositions& P, const FCone& Shape, int32* OutIndices)
+{
+	return FilterScalar(P, Shape, 0, OutIndices, 0);
+}
+
+int32 Cow::Kernels::Scalar::Filter(const FPositions& P, const FFrustum& Shape, int32* OutIndices)
+{
+	return FilterScalar(P, Shape, 0, OutIndices, 0);
+}
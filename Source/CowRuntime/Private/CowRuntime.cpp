@@ -2,5 +2,17 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "CowAsyncLoadQueue.h"
+#include "CowClassAncestry.h"
 
-IMPLEMENT_MODULE(FDefaultGameModuleImpl, CowRuntime);
\ No newline at end of file
+class FCowRuntimeModule : public IModuleInterface
+{
+public:
+	virtual void ShutdownModule() override
+	{
+		FCowAsyncLoadQueue::Shutdown();
+		FCowClassAncestry::Shutdown();
+	}
+};
+
+IMPLEMENT_MODULE(FCowRuntimeModule, CowRuntime);
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowSoftReferenceManifest.h"
+
+// Engine
+#include "AssetRegistry/AssetRegistryModule.h"
+
+FString FCowSoftReferenceManifest::MakeTagValue(TArray<FSoftObjectPath> Paths)
+{
+	Paths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+	Paths.Sort([](const FSoftObjectPath& A, const FSoftObjectPath& B) { return A.LexicalLess(B); });
+
+	// Object names can't contain commas
+	TStringBuilder<1024> Value;
+	for (int32 Index = 0; Index < Paths.Num(); ++Index)
+	{
+		if (Index > 0 && Paths[Index] == Paths[Index - 1])
+		{
+			continue;
+		}
+		if (Value.Len() > 0)
+		{
+			Value << TEXT(',');
+		}
+		Paths[Index].AppendString(Value);
+	}
+	return FString(Value.ToView());
+}
+
+void FCowSoftReferenceManifest::ParseTagValue(const FString& Value, TArray<FSoftObjectPath>& OutPaths)
+{
+	TArray<FString> Strings;
+	Value.ParseIntoArray(Strings, TEXT(","));
+
+	OutPaths.Reserve(OutPaths.Num() + Strings.Num());
+	for (const FString& String : Strings)
+	{
+		FSoftObjectPath Path(String);
+		if (!Path.IsNull())
+		{
+			OutPaths.Add(MoveTemp(Path));
+		}
+	}
+}
+
+bool FCowSoftReferenceManifest::GetSoftReferences(FName PackageName, TArray<FSoftObjectPath>& OutPaths)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, Assets, /*bIncludeOnlyOnDiskAssets*/ true);
+
+	bool bFound = false;
+	for (const FAssetData& Asset : Assets)
+	{
+		FString Value;
+		if (Asset.GetTagValue(TagName, Value))
+		{
+			ParseTagValue(Value, OutPaths);
+			bFound = true;
+		}
+	}
+	return bFound;
+}
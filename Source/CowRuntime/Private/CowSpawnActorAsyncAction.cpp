@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowSpawnActorAsyncAction.h"
+
+// Engine
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "TimerManager.h"
+
+// Cow
+#include "CowAsync.h"
+#include "CowTrace.h"
+
+UCowSpawnActorAsyncAction* UCowSpawnActorAsyncAction::CowSpawnActorAsync(UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const FTransform& SpawnTransform,
+	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, AActor* Owner, FGuid NodeGuid, ESpawnActorScaleMethod TransformScaleMethod)
+{
+	UCowSpawnActorAsyncAction* Action = NewObject<UCowSpawnActorAsyncAction>();
+	Action->WorldContextObject = WorldContextObject;
+	Action->ActorClass = ActorClass;
+	Action->SpawnTransform = SpawnTransform;
+	Action->CollisionHandlingOverride = CollisionHandlingOverride;
+	Action->TransformScaleMethod = TransformScaleMethod;
+	Action->Owner = Owner;
+	Action->NodeGuid = NodeGuid;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UCowSpawnActorAsyncAction::Activate()
+{
+	RequestCycle = FPlatformTime::Cycles64();
+
+	if (ActorClass.IsNull())
+	{
+		// Keep LoadAsset behaviour: completion (with nullptr) is never executed in the same frame
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull))
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowSpawnActorAsyncAction::OnActorClassLoaded));
+		}
+		else
+		{
+			SetReadyToDestroy();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowSpawnActorAsyncAction::RequestLoad);
+
+	// Load queue executes the callback on the next tick even if the class is already loaded (same 1 frame delay LoadAsset has)
+	LoadRequestId = FCowAsyncLoadQueue::Get().Request(ActorClass.ToSoftObjectPath(), [WeakThis = TWeakObjectPtr<UCowSpawnActorAsyncAction>(this)]()
+	{
+		if (UCowSpawnActorAsyncAction* This = WeakThis.Get())
+		{
+			This->OnActorClassLoaded();
+		}
+	});
+}
+
+void UCowSpawnActorAsyncAction::OnActorClassLoaded()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowSpawnActorAsyncAction::OnActorClassLoaded);
+
+	LoadRequestId = 0;
+
+	// Owner is gone, same as latent LoadAsset we simply never complete
+	UObject* Context = WorldContextObject.Get();
+	if (!Context)
+	{
+		SetReadyToDestroy();
+		return;
+	}
+
+	Cow::FSpawnActorAsyncParams Params;
+	Params.CollisionHandlingOverride = CollisionHandlingOverride;
+	Params.TransformScaleMethod = TransformScaleMethod;
+	Params.Owner = Owner.Get();
+
+	AActor* Actor = Cow::Private::BeginSpawnActor(Context, ActorClass.Get(), SpawnTransform, Params);
+	if (Actor)
+	{
+		// ExposeOnSpawn assignments generated by the node are executed right here
+		BeginSpawn.Broadcast(Actor);
+
+		Actor = Cow::Private::FinishSpawnActor(Actor, SpawnTransform, Params);
+	}
+
+	TRACE_COW_ASYNC_REQUEST(NodeGuid, ActorClass.ToSoftObjectPath(), RequestCycle, FPlatformTime::Cycles64(), Actor ? 1 : 0);
+	Completed.Broadcast(Actor);
+
+	SetReadyToDestroy();
+}
+
+void UCowSpawnActorAsyncAction::BeginDestroy()
+{
+	// Destroyed before completion, nobody else may need the class anymore
+	if (FCowAsyncLoadQueue* LoadQueue = FCowAsyncLoadQueue::TryGet())
+	{
+		LoadQueue->Cancel(LoadRequestId);
+	}
+	LoadRequestId = 0;
+
+	Super::BeginDestroy();
+}
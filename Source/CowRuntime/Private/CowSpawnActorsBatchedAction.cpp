@@ -0,0 +1,195 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowSpawnActorsBatchedAction.h"
+
+// Engine
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+#include "Algo/Count.h"
+
+// Cow
+#include "CowAsync.h"
+#include "CowStats.h"
+#include "CowTrace.h"
+
+namespace CowSpawnBudget
+{
+	float GFrameBudgetMs = 2.f;
+	FAutoConsoleVariableRef CVarFrameBudgetMs(
+		TEXT("cow.SpawnBatched.FrameBudgetMs"),
+		GFrameBudgetMs,
+		TEXT("Game thread time per frame all CowSpawnActorsBatched nodes together may spend spawning (default: 2), every batch spawns at least one instance per frame"));
+
+	uint64 Frame = MAX_uint64;
+	double SpentSeconds = 0.0;
+
+	bool HasBudget()
+	{
+		if (Frame != GFrameCounter)
+		{
+			Frame = GFrameCounter;
+			SpentSeconds = 0.0;
+		}
+		return SpentSeconds * 1000.0 < GFrameBudgetMs;
+	}
+}
+
+UCowSpawnActorsBatchedAction* UCowSpawnActorsBatchedAction::CowSpawnActorsBatched(UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const TArray<FTransform>& SpawnTransforms,
+	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, AActor* Owner, FGuid NodeGuid, ESpawnActorScaleMethod TransformScaleMethod)
+{
+	UCowSpawnActorsBatchedAction* Action = NewObject<UCowSpawnActorsBatchedAction>();
+	Action->WorldContextObject = WorldContextObject;
+	Action->ActorClass = ActorClass;
+	Action->SpawnTransforms = SpawnTransforms;
+	Action->CollisionHandlingOverride = CollisionHandlingOverride;
+	Action->TransformScaleMethod = TransformScaleMethod;
+	Action->Owner = Owner;
+	Action->NodeGuid = NodeGuid;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UCowSpawnActorsBatchedAction::Activate()
+{
+	RequestCycle = FPlatformTime::Cycles64();
+	INC_DWORD_STAT_BY(STAT_Cow_PendingBatchedSpawns, SpawnTransforms.Num());
+	bPendingCounted = true;
+
+	if (ActorClass.IsNull() || SpawnTransforms.IsEmpty())
+	{
+		// Keep LoadAsset behaviour: completion is never executed in the same frame
+		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull))
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowSpawnActorsBatchedAction::OnActorClassLoaded));
+		}
+		else
+		{
+			SetReadyToDestroy();
+		}
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowSpawnActorsBatchedAction::RequestLoad);
+
+	// Class is loaded once for the whole batch
+	LoadRequestId = FCowAsyncLoadQueue::Get().Request(ActorClass.ToSoftObjectPath(), [WeakThis = TWeakObjectPtr<UCowSpawnActorsBatchedAction>(this)]()
+	{
+		if (UCowSpawnActorsBatchedAction* This = WeakThis.Get())
+		{
+			This->OnActorClassLoaded();
+		}
+	});
+}
+
+void UCowSpawnActorsBatchedAction::OnActorClassLoaded()
+{
+	LoadRequestId = 0;
+
+	// Null entries keep Completed's Actors aligned with SpawnTransforms
+	SpawnedActors.SetNumZeroed(SpawnTransforms.Num());
+
+	if (ActorClass.Get() == nullptr)
+	{
+		DEC_DWORD_STAT_BY(STAT_Cow_PendingBatchedSpawns, SpawnTransforms.Num());
+		NextIndex = SpawnTransforms.Num();
+	}
+
+	SpawnPendingInstances();
+}
+
+void UCowSpawnActorsBatchedAction::SpawnPendingInstances()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCowSpawnActorsBatchedAction::SpawnPendingInstances);
+
+	// Owner is gone, same as latent LoadAsset we simply never complete
+	UObject* Context = WorldContextObject.Get();
+	if (!Context)
+	{
+		SetReadyToDestroy();
+		return;
+	}
+
+	UClass* Class = ActorClass.Get();
+	// First instance of every batch doesn't check the budget, otherwise a batch that runs first each frame
+	// could use it all up and starve the others (HasBudget still goes first to start the frame's budget)
+	for (bool bFirstInFrame = true; NextIndex < SpawnTransforms.Num() && (CowSpawnBudget::HasBudget() || bFirstInFrame); bFirstInFrame = false)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 Index = NextIndex++;
+		SpawnedActors[Index] = SpawnInstance(Context, Class, Index);
+		DEC_DWORD_STAT(STAT_Cow_PendingBatchedSpawns);
+		CowSpawnBudget::SpentSeconds += FPlatformTime::Seconds() - StartTime;
+	}
+
+	if (NextIndex < SpawnTransforms.Num())
+	{
+		UWorld* World = GEngine->GetWorldFromContextObject(Context, EGetWorldErrorMode::LogAndReturnNull);
+		if (World)
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCowSpawnActorsBatchedAction::SpawnPendingInstances));
+		}
+		else
+		{
+			SetReadyToDestroy();
+		}
+		return;
+	}
+
+	Finish();
+}
+
+AActor* UCowSpawnActorsBatchedAction::SpawnInstance(UObject* Context, UClass* Class, int32 Index)
+{
+	Cow::FSpawnActorAsyncParams Params;
+	Params.CollisionHandlingOverride = CollisionHandlingOverride;
+	Params.TransformScaleMethod = TransformScaleMethod;
+	Params.Owner = Owner.Get();
+
+	const FTransform& SpawnTransform = SpawnTransforms[Index];
+	AActor* Actor = Cow::Private::BeginSpawnActor(Context, Class, SpawnTransform, Params);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	// ExposeOnSpawn assignments generated by the node are executed right here
+	BeginSpawn.Broadcast(Actor, Index);
+
+	Actor = Cow::Private::FinishSpawnActor(Actor, SpawnTransform, Params);
+	if (Actor)
+	{
+		Spawned.Broadcast(Actor, Index);
+	}
+	return Actor;
+}
+
+void UCowSpawnActorsBatchedAction::Finish()
+{
+	bPendingCounted = false;
+
+	TRACE_COW_ASYNC_REQUEST(NodeGuid, ActorClass.ToSoftObjectPath(), RequestCycle, FPlatformTime::Cycles64(),
+		Algo::CountIf(SpawnedActors, [](const AActor* Actor) { return Actor != nullptr; }));
+	Completed.Broadcast(ToRawPtrTArrayUnsafe(SpawnedActors));
+
+	SetReadyToDestroy();
+}
+
+void UCowSpawnActorsBatchedAction::BeginDestroy()
+{
+	// Destroyed before all instances were spawned (e.g. owner is gone or game instance shut down)
+	if (FCowAsyncLoadQueue* LoadQueue = FCowAsyncLoadQueue::TryGet())
+	{
+		LoadQueue->Cancel(LoadRequestId);
+	}
+	LoadRequestId = 0;
+
+	if (bPendingCounted)
+	{
+		DEC_DWORD_STAT_BY(STAT_Cow_PendingBatchedSpawns, SpawnTransforms.Num() - NextIndex);
+		bPendingCounted = false;
+	}
+
+	Super::BeginDestroy();
+}
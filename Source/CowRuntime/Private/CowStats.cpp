@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowStats.h"
+
+// Engine
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/Class.h"
+
+DEFINE_STAT(STAT_Cow_GetAllActorsOfClass);
+DEFINE_STAT(STAT_Cow_GetActorOfClass);
+DEFINE_STAT(STAT_Cow_GetAllActorsOfClassInShape);
+DEFINE_STAT(STAT_Cow_GetAllComponentsOfClass);
+DEFINE_STAT(STAT_Cow_GetAllWidgetsOfClass);
+DEFINE_STAT(STAT_Cow_CreateWidget);
+DEFINE_STAT(STAT_Cow_SpawnActor);
+DEFINE_STAT(STAT_Cow_ConstructObject);
+DEFINE_STAT(STAT_Cow_ClassAncestry);
+DEFINE_STAT(STAT_Cow_ActorIndexBuild);
+DEFINE_STAT(STAT_Cow_ActorIndexPositions);
+DEFINE_STAT(STAT_Cow_ActorsScanned);
+DEFINE_STAT(STAT_Cow_QueryMemoHits);
+DEFINE_STAT(STAT_Cow_QueryMemoMisses);
+DEFINE_STAT(STAT_Cow_PendingWidgetLoads);
+DEFINE_STAT(STAT_Cow_PendingBatchedSpawns);
+DEFINE_STAT(STAT_Cow_PendingAssetLoads);
+DEFINE_STAT(STAT_Cow_PendingClassLoads);
+DEFINE_STAT(STAT_Cow_CoalescedClassLoads);
+DEFINE_STAT(STAT_Cow_HeldBackgroundLoads);
+DEFINE_STAT(STAT_Cow_CallSiteMemory);
+DEFINE_STAT(STAT_Cow_QueryOutputBytes);
+
+#if COW_STATS_ENABLED
+
+namespace
+{
+	bool GCowStatsEnable = true;
+	FAutoConsoleVariableRef CVarCowStatsEnable(
+		TEXT("cow.Stats.Enable"),
+		GCowStatsEnable,
+		TEXT("Collect per call site counters of Cow nodes for cow.Stats (default: 1)"));
+
+	template<typename CallSiteType>
+	double GetAverageScanned(const CallSiteType& CallSite)
+	{
+		return CallSite.Calls > 0 ? static_cast<double>(CallSite.ActorsScanned) / CallSite.Calls : 0.0;
+	}
+
+	const TCHAR* LexToString(ECowCallSiteKind Kind)
+	{
+		switch (Kind)
+		{
+			case ECowCallSiteKind::GetAllActorsOfClass: return TEXT("GetAllActorsOfClass");
+			case ECowCallSiteKind::GetActorOfClass:		return TEXT("GetActorOfClass");
+			case ECowCallSiteKind::GetAllComponentsOfClass: return TEXT("GetAllComponentsOfClass");
+			case ECowCallSiteKind::GetAllWidgetsOfClass:	return TEXT("GetAllWidgetsOfClass");
+			case ECowCallSiteKind::GetAllActorsOfClassInShape: return TEXT("GetAllActorsOfClassInShape");
+			default:									return TEXT("CreateWidgetAsync");
+		}
+	}
+
+	FAutoConsoleCommandWithArgsAndOutputDevice CowStatsCommand(
+		TEXT("cow.Stats"),
+		TEXT("Dumps top call sites of Cow nodes.\n")
+		TEXT("Usage: cow.Stats [Count=20] [time|calls|scanned|pending] | cow.Stats reset\n")
+		TEXT("scanned sorts by actors scanned per call"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			int32 TopCount = 20;
+			FCowCallSiteStats::ESortBy SortBy = FCowCallSiteStats::ESortBy::Time;
+
+			for (const FString& Arg : Args)
+			{
+				if (Arg == TEXT("reset"))
+				{
+					FCowCallSiteStats::Get().Reset();
+					Ar.Logf(TEXT("Cow call site stats reset"));
+					return;
+				}
+				else if (Arg.IsNumeric())
+				{
+					TopCount = FMath::Max(FCString::Atoi(*Arg), 1);
+				}
+				else if (Arg == TEXT("calls"))
+				{
+					SortBy = FCowCallSiteStats::ESortBy::Calls;
+				}
+				else if (Arg == TEXT("scanned"))
+				{
+					SortBy = FCowCallSiteStats::ESortBy::Scanned;
+				}
+				else if (Arg == TEXT("pending"))
+				{
+					SortBy = FCowCallSiteStats::ESortBy::Pending;
+				}
+			}
+
+			FCowCallSiteStats::Get().Dump(Ar, TopCount, SortBy);
+		}));
+}
+
+FCowCallSiteStats& FCowCallSiteStats::Get()
+{
+	static FCowCallSiteStats Instance;
+	return Instance;
+}
+
+bool FCowCallSiteStats::IsEnabled()
+{
+	return GCowStatsEnable && IsInGameThread();
+}
+
+FCowCallSiteStats::FCallSite* FCowCallSiteStats::FindOrAdd(ECowCallSiteKind Kind, const FGuid& NodeGuid, const UClass* CallerClass)
+{
+	// Node of a Blueprint is called by its subclasses as well, they're all the same call site
+	const FKey Key{ Kind, NodeGuid, NodeGuid.IsValid() ? nullptr : CallerClass };
+
+	if (FCallSite* CallSite = CallSites.Find(Key))
+	{
+		// Walk up to the common parent, callers are all children of the class that contains the node
+		const UClass* KnownClass = CallSite->CallerClass.Get();
+		if (CallerClass && KnownClass && !CallerClass->IsChildOf(KnownClass))
+		{
+			const UClass* CommonClass = KnownClass;
+			while (CommonClass && !CallerClass->IsChildOf(CommonClass))
+			{
+				CommonClass = CommonClass->GetSuperClass();
+			}
+			CallSite->CallerClass = CommonClass;
+			CallSite->CallerName = CommonClass ? CommonClass->GetPathName() : TEXT("<native>");
+		}
+		return CallSite;
+	}
+
+	FCallSite& CallSite = CallSites.Add(Key);
+	CallSite.CallerClass = CallerClass;
+	CallSite.CallerName = CallerClass ? CallerClass->GetPathName() : TEXT("<native>");
+	SET_MEMORY_STAT(STAT_Cow_CallSiteMemory, CallSites.GetAllocatedSize());
+	return &CallSite;
+}
+
+void FCowCallSiteStats::RecordActorQuery(ECowCallSiteKind Kind, const FGuid& NodeGuid, const UObject* Caller, uint64 Cycles, int32 ActorsScanned)
+{
+	FCallSite* CallSite = FindOrAdd(Kind, NodeGuid, Caller ? Caller->GetClass() : nullptr);
+	++CallSite->Calls;
+	CallSite->Cycles += Cycles;
+	CallSite->ActorsScanned += ActorsScanned;
+}
+
+void FCowCallSiteStats::RecordWidgetRequest(const FGuid& NodeGuid, const UClass* CallerClass)
+{
+	FCallSite* CallSite = FindOrAdd(ECowCallSiteKind::CreateWidgetAsync, NodeGuid, CallerClass);
+	++CallSite->Calls;
+	++CallSite->Pending;
+}
+
+void FCowCallSiteStats::RecordWidgetCompleted(const FGuid& NodeGuid, const UClass* CallerClass, uint64 LatencyCycles, uint64 CreateCycles)
+{
+	FCallSite* CallSite = FindOrAdd(ECowCallSiteKind::CreateWidgetAsync, NodeGuid, CallerClass);
+	CallSite->Pending = FMath::Max(CallSite->Pending - 1, 0);
+	++CallSite->Completed;
+	CallSite->Cycles += CreateCycles;
+	CallSite->LatencyCycles += LatencyCycles;
+}
+
+void FCowCallSiteStats::RecordWidgetCancelled(const FGuid& NodeGuid, const UClass* CallerClass)
+{
+	FCallSite* CallSite = FindOrAdd(ECowCallSiteKind::CreateWidgetAsync, NodeGuid, CallerClass);
+	CallSite->Pending = FMath::Max(CallSite->Pending - 1, 0);
+}
+
+void FCowCallSiteStats::Dump(FOutputDevice& Ar, int32 TopCount, ESortBy SortBy) const
+{
+	TArray<TPair<const FKey*, const FCallSite*>> Sorted;
+	Sorted.Reserve(CallSites.Num());
+	for (const TPair<FKey, FCallSite>& Pair : CallSites)
+	{
+		Sorted.Emplace(&Pair.Key, &Pair.Value);
+	}
+
+	Sorted.Sort([SortBy](const TPair<const FKey*, const FCallSite*>& A, const TPair<const FKey*, const FCallSite*>& B)
+	{
+		switch (SortBy)
+		{
+			case ESortBy::Calls:   return A.Value->Calls > B.Value->Calls;
+			case ESortBy::Scanned: return GetAverageScanned(*A.Value) > GetAverageScanned(*B.Value);
+			case ESortBy::Pending: return A.Value->Pending > B.Value->Pending;
+			default:			   return A.Value->Cycles > B.Value->Cycles;
+		}
+	});
+
+	Ar.Logf(TEXT("Cow call sites: %d (showing top %d)"), Sorted.Num(), FMath::Min(TopCount, Sorted.Num()));
+	Ar.Logf(TEXT("%-20s %10s %10s %10s %10s %8s %12s  %-32s %s"),
+		TEXT("Kind"), TEXT("TotalMs"), TEXT("Calls"), TEXT("AvgUs"), TEXT("AvgScan"), TEXT("Pending"), TEXT("AvgLatMs"), TEXT("Node"), TEXT("Asset"));
+
+	for (int32 Index = 0; Index < Sorted.Num() && Index < TopCount; ++Index)
+	{
+		const FKey& Key = *Sorted[Index].Key;
+		const FCallSite& CallSite = *Sorted[Index].Value;
+
+		// Widget time is spent only by completed requests
+		const int64 TimedCalls = Key.Kind == ECowCallSiteKind::CreateWidgetAsync ? CallSite.Completed : CallSite.Calls;
+		const double TotalMs = FPlatformTime::ToMilliseconds64(CallSite.Cycles);
+		const double AvgUs = TimedCalls > 0 ? TotalMs * 1000.0 / TimedCalls : 0.0;
+		const double AvgScanned = GetAverageScanned(CallSite);
+		const double AvgLatencyMs = CallSite.Completed > 0 ? FPlatformTime::ToMilliseconds64(CallSite.LatencyCycles) / CallSite.Completed : 0.0;
+
+		Ar.Logf(TEXT("%-20s %10.3f %10lld %10.2f %10.1f %8d %12.2f  %-32s %s"),
+			LexToString(Key.Kind), TotalMs, CallSite.Calls, AvgUs, AvgScanned, CallSite.Pending, AvgLatencyMs,
+			*Key.NodeGuid.ToString(EGuidFormats::Digits), *CallSite.CallerName);
+	}
+}
+
+void FCowCallSiteStats::Reset()
+{
+	// Keep pending requests, otherwise their completion would be reported without the request
+	for (auto It = CallSites.CreateIterator(); It; ++It)
+	{
+		FCallSite& CallSite = It->Value;
+		if (CallSite.Pending > 0)
+		{
+			CallSite.Calls = 0;
+			CallSite.Cycles = 0;
+			CallSite.ActorsScanned = 0;
+			CallSite.LatencyCycles = 0;
+			CallSite.Completed = 0;
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+	SET_MEMORY_STAT(STAT_Cow_CallSiteMemory, CallSites.GetAllocatedSize());
+}
+
+#endif // COW_STATS_ENABLED
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "CowTrace.h"
+
+#if COW_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(CowChannel);
+
+UE_TRACE_EVENT_BEGIN(Cow, ActorQuery)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+	UE_TRACE_EVENT_FIELD(int32, ActorsScanned)
+	UE_TRACE_EVENT_FIELD(int32, ActorsReturned)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassPath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Cow, WidgetLoadStart)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassPath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Cow, WidgetLoadEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+	UE_TRACE_EVENT_FIELD(bool, bLoaded)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassPath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Cow, WidgetCreate)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassPath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Cow, AsyncRequest)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+	UE_TRACE_EVENT_FIELD(int32, NumObjects)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Path)
+UE_TRACE_EVENT_END()
+
+void FCowTrace::OutputActorQuery(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, uint64 StartCycle, uint64 EndCycle, int32 ActorsScanned, int32 ActorsReturned)
+{
+	// Don't pay for the path string when nobody listens
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CowChannel))
+	{
+		return;
+	}
+
+	const FString Path = ClassPath.ToString();
+	UE_TRACE_LOG(Cow, ActorQuery, CowChannel)
+		<< ActorQuery.StartCycle(StartCycle)
+		<< ActorQuery.EndCycle(EndCycle)
+		<< ActorQuery.NodeGuid(&NodeGuid.A, 4)
+		<< ActorQuery.ActorsScanned(ActorsScanned)
+		<< ActorQuery.ActorsReturned(ActorsReturned)
+		<< ActorQuery.ClassPath(*Path, Path.Len());
+}
+
+void FCowTrace::OutputWidgetLoadStart(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CowChannel))
+	{
+		return;
+	}
+
+	const FString Path = ClassPath.ToString();
+	UE_TRACE_LOG(Cow, WidgetLoadStart, CowChannel)
+		<< WidgetLoadStart.Cycle(FPlatformTime::Cycles64())
+		<< WidgetLoadStart.NodeGuid(&NodeGuid.A, 4)
+		<< WidgetLoadStart.ClassPath(*Path, Path.Len());
+}
+
+void FCowTrace::OutputWidgetLoadEnd(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, bool bLoaded)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CowChannel))
+	{
+		return;
+	}
+
+	const FString Path = ClassPath.ToString();
+	UE_TRACE_LOG(Cow, WidgetLoadEnd, CowChannel)
+		<< WidgetLoadEnd.Cycle(FPlatformTime::Cycles64())
+		<< WidgetLoadEnd.NodeGuid(&NodeGuid.A, 4)
+		<< WidgetLoadEnd.bLoaded(bLoaded)
+		<< WidgetLoadEnd.ClassPath(*Path, Path.Len());
+}
+
+void FCowTrace::OutputWidgetCreate(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, uint64 StartCycle, uint64 EndCycle)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CowChannel))
+	{
+		return;
+	}
+
+	const FString Path = ClassPath.ToString();
+	UE_TRACE_LOG(Cow, WidgetCreate, CowChannel)
+		<< WidgetCreate.StartCycle(StartCycle)
+		<< WidgetCreate.EndCycle(EndCycle)
+		<< WidgetCreate.NodeGuid(&NodeGuid.A, 4)
+		<< WidgetCreate.ClassPath(*Path, Path.Len());
+}
+
+void FCowTrace::OutputAsyncRequest(const FGuid& NodeGuid, const FSoftObjectPath& Path, uint64 StartCycle, uint64 EndCycle, int32 NumObjects)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CowChannel))
+	{
+		return;
+	}
+
+	const FString PathString = Path.ToString();
+	UE_TRACE_LOG(Cow, AsyncRequest, CowChannel)
+		<< AsyncRequest.StartCycle(StartCycle)
+		<< AsyncRequest.EndCycle(EndCycle)
+		<< AsyncRequest.NodeGuid(&NodeGuid.A, 4)
+		<< AsyncRequest.NumObjects(NumObjects)
+		<< AsyncRequest.Path(*PathString, PathString.Len());
+}
+
+#endif // COW_TRACE_ENABLED
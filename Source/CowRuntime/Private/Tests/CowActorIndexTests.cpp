@@ -0,0 +1,116 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Engine/Engine.h"
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+
+// Cow
+#include "CowActorIndexSubsystem.h"
+
+namespace CowActorIndexTests
+{
+	ATargetPoint* Spawn(UWorld* World, const FVector& Location)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		return World->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator, SpawnParameters);
+	}
+
+	TArray<ATargetPoint*> Collect(UWorld* World)
+	{
+		TArray<ATargetPoint*> Actors;
+		for (ATargetPoint* Actor : TCowActorView<ATargetPoint>(World))
+		{
+			Actors.Add(Actor);
+		}
+		return Actors;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCowActorIndexIterationTest, "Cow.ActorIndex.ChangesDuringIteration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCowActorIndexIterationTest::RunTest(const FString& Parameters)
+{
+	using namespace CowActorIndexTests;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/ false, TEXT("CowActorIndexTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	TArray<ATargetPoint*> Original;
+	for (int32 Index = 0; Index < 10; ++Index)
+	{
+		Original.Add(Spawn(World, FVector(Index * 1000.0, 0.0, 0.0)));
+	}
+
+	// Built on the first query from the actors already in the world
+	TestEqual(TEXT("Index sees actors spawned before the first query"), Collect(World).Num(), Original.Num());
+
+	TSet<AActor*> Destroyed;
+	TSet<AActor*> DestroyedAhead;
+	TArray<ATargetPoint*> Visited;
+	TArray<ATargetPoint*> SpawnedDuringIteration;
+	for (ATargetPoint* Actor : TCowActorView<ATargetPoint>(World))
+	{
+		Visited.Add(Actor);
+
+		// Removals while iterating: the current actor and the one after the next, which must then be skipped
+		if (Visited.Num() % 3 == 1)
+		{
+			const int32 Ahead = Original.IndexOfByKey(Actor) + 2;
+			if (Original.IsValidIndex(Ahead) && !Destroyed.Contains(Original[Ahead]))
+			{
+				Destroyed.Add(Original[Ahead]);
+				DestroyedAhead.Add(Original[Ahead]);
+				World->DestroyActor(Original[Ahead]);
+			}
+			Destroyed.Add(Actor);
+			World->DestroyActor(Actor);
+		}
+
+		// Additions while iterating aren't visited, nested views don't see them either
+		if (Visited.Num() == 2)
+		{
+			SpawnedDuringIteration.Add(Spawn(World, FVector(0.0, 5000.0, 0.0)));
+			TestFalse(TEXT("Nested view doesn't see actors spawned while iterating"), Collect(World).Contains(SpawnedDuringIteration.Last()));
+		}
+	}
+
+	for (ATargetPoint* Actor : Visited)
+	{
+		TestFalse(TEXT("Spawned actor isn't visited by the view it was spawned in"), SpawnedDuringIteration.Contains(Actor));
+		TestFalse(TEXT("Actor destroyed ahead of the iterator is skipped"), DestroyedAhead.Contains(Actor));
+	}
+	TestEqual(TEXT("Every actor that wasn't destroyed ahead of the iterator is visited once"), Visited.Num(), Original.Num() - DestroyedAhead.Num());
+
+	// Compacted once the last view is gone, spawned actors are added then
+	const TArray<ATargetPoint*> After = Collect(World);
+	TestEqual(TEXT("Removed actors are gone and added ones are in after iteration"), After.Num(), Original.Num() - Destroyed.Num() + SpawnedDuringIteration.Num());
+	for (AActor* Actor : Destroyed)
+	{
+		TestFalse(TEXT("Destroyed actor isn't in the index"), After.Contains(Cast<ATargetPoint>(Actor)));
+	}
+	for (ATargetPoint* Actor : SpawnedDuringIteration)
+	{
+		TestTrue(TEXT("Actor spawned while iterating is in the index"), After.Contains(Actor));
+	}
+
+	// Positions moved with their actors by compaction
+	for (ATargetPoint* Actor : After)
+	{
+		TestEqual(TEXT("Nearest actor to an actor's location is the actor"), Cow::FindNearestActor<ATargetPoint>(World, Actor->GetActorLocation(), 1.f), Actor);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
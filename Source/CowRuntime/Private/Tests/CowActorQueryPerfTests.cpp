@@ -0,0 +1,167 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Engine/Engine.h"
+#include "Engine/Note.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+// Cow
+#include "CowActorIndexSubsystem.h"
+#include "CowAllocationCounter.h"
+#include "CowFunctionLibrary.h"
+
+/**
+ * Actor-of-class queries, Cow and stock, in a headless game world with 1k, 10k and 100k actors at 0.1%, 10% and 100% hit ratios
+ * Classes are native only (runtime module can't create Blueprints), CowActorQueryBenchmark commandlet covers Blueprint hierarchies and shape queries
+ * Reports median, p99 and allocations per call, fails only if the queries disagree on the result
+ */
+namespace CowActorQueryPerfTests
+{
+	constexpr int32 Iterations = 50;
+
+	struct FResult
+	{
+		TArray<double> Microseconds;
+		Cow::FAllocationCount Allocations;
+		int32 Matches = 0;
+	};
+
+	// Nearest-rank, same as FCowBenchmarkUtilities::Percentile of CowNodes
+	double Percentile(TArray<double> Samples, double Percent)
+	{
+		if (Samples.IsEmpty())
+		{
+			return 0.0;
+		}
+		Samples.Sort();
+		const int32 Rank = FMath::CeilToInt32(Percent / 100.0 * Samples.Num());
+		return Samples[FMath::Clamp(Rank - 1, 0, Samples.Num() - 1)];
+	}
+
+	// Targets are spread evenly through the spawn order, so they don't end up next to each other in memory
+	void SpawnActors(UWorld* World, int32 ActorCount, double HitRatio)
+	{
+		const TArray<UClass*> Fillers = { AActor::StaticClass(), AStaticMeshActor::StaticClass(), ANote::StaticClass() };
+		const int32 TargetCount = FMath::Clamp(FMath::RoundToInt32(ActorCount * HitRatio / 100.0), 1, ActorCount);
+		const double TargetStep = static_cast<double>(ActorCount) / TargetCount;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+
+		int32 SpawnedTargets = 0;
+		double NextTarget = 0.0;
+		for (int32 Index = 0; Index < ActorCount; ++Index)
+		{
+			UClass* Class = Fillers[Index % Fillers.Num()];
+			if (SpawnedTargets < TargetCount && Index >= NextTarget)
+			{
+				Class = ATargetPoint::StaticClass();
+				++SpawnedTargets;
+				NextTarget += TargetStep;
+			}
+			World->SpawnActor(Class, nullptr, SpawnParameters);
+		}
+	}
+
+	template<typename FuncType>
+	FResult Measure(FuncType&& Query)
+	{
+		FResult Result;
+		// Warm up, grows the reused output array
+		Result.Matches = Query();
+
+		Result.Microseconds.Reserve(Iterations);
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			{
+				Cow::FScopedAllocationCounter AllocationCounter(Result.Allocations);
+				Query();
+			}
+			Result.Microseconds.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+		}
+		return Result;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCowActorQueryPerfTest, "Cow.Performance.ActorQueries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FCowActorQueryPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* ActorCount : { TEXT("1000"), TEXT("10000"), TEXT("100000") })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%s actors"), ActorCount));
+		OutTestCommands.Add(ActorCount);
+	}
+}
+
+bool FCowActorQueryPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace CowActorQueryPerfTests;
+
+	const int32 ActorCount = FCString::Atoi(*Parameters);
+	if (!Cow::FScopedAllocationCounter::IsAvailable())
+	{
+		AddWarning(TEXT("Allocations can't be counted, GMalloc couldn't be wrapped"));
+	}
+
+	for (const double HitRatio : { 0.1, 10.0, 100.0 })
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/ false, TEXT("CowActorQueryPerfTest"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		SpawnActors(World, ActorCount, HitRatio);
+
+		const TSoftClassPtr<AActor> SoftTarget(ATargetPoint::StaticClass());
+		TArray<AActor*> OutActors;
+
+		// Memo is flushed so every call walks the index, as the first query of a frame does
+		const FResult CowGetAll = Measure([World, &SoftTarget, &OutActors]()
+		{
+			UCowActorIndexSubsystem::Get(World)->FlushQueryMemo();
+			UCowFunctionLibrary::CowGetAllActorsOfClass(World, SoftTarget, OutActors);
+			return OutActors.Num();
+		});
+		const FResult CowGetOne = Measure([World, &SoftTarget]()
+		{
+			UCowActorIndexSubsystem::Get(World)->FlushQueryMemo();
+			AActor* OutActor = nullptr;
+			UCowFunctionLibrary::CowGetActorOfClass(World, SoftTarget, OutActor);
+			return OutActor ? 1 : 0;
+		});
+		const FResult StockGetAll = Measure([World, &OutActors]()
+		{
+			UGameplayStatics::GetAllActorsOfClass(World, ATargetPoint::StaticClass(), OutActors);
+			return OutActors.Num();
+		});
+
+		TestEqual(FString::Printf(TEXT("Hit %g%%: CowGetAllActorsOfClass finds what GetAllActorsOfClass does"), HitRatio), CowGetAll.Matches, StockGetAll.Matches);
+		TestEqual(FString::Printf(TEXT("Hit %g%%: CowGetActorOfClass finds an actor"), HitRatio), CowGetOne.Matches, 1);
+
+		auto Report = [this, ActorCount, HitRatio](const TCHAR* Query, const FResult& Result)
+		{
+			AddInfo(FString::Printf(TEXT("%-36s Actors=%-7d Hit=%-5g%% Matches=%-7d Median=%.2fus P99=%.2fus Allocs/call=%.2f Bytes/call=%.1f"),
+				Query, ActorCount, HitRatio, Result.Matches, Percentile(Result.Microseconds, 50.0), Percentile(Result.Microseconds, 99.0),
+				static_cast<double>(Result.Allocations.Allocations) / Iterations, static_cast<double>(Result.Allocations.Bytes) / Iterations));
+		};
+		Report(TEXT("CowGetAllActorsOfClass"), CowGetAll);
+		Report(TEXT("CowGetActorOfClass"), CowGetOne);
+		Report(TEXT("GameplayStatics::GetAllActorsOfClass"), StockGetAll);
+
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(/*bInformEngineOfWorld*/ false);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,49 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Containers/Ticker.h"
+
+// Cow
+#include "CowAsyncLoadQueue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCowAsyncLoadQueuePriorityTest, "Cow.AsyncLoadQueue.PriorityOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+// Null path never touches the streamable manager and completes on the next tick, so the order is deterministic
+bool FCowAsyncLoadQueuePriorityTest::RunTest(const FString& Parameters)
+{
+	FCowAsyncLoadQueue& Queue = FCowAsyncLoadQueue::Get();
+	const FSoftObjectPath Path;
+	const int32 PendingBefore = Queue.NumPendingLoads();
+
+	TArray<FString> Calls;
+	auto Waiter = [&Calls](const TCHAR* Name)
+	{
+		return [&Calls, Name]() { Calls.Add(Name); };
+	};
+
+	Queue.Request(Path, Waiter(TEXT("Background")), ECowLoadPriority::Background);
+	Queue.Request(Path, Waiter(TEXT("Gameplay")), ECowLoadPriority::Gameplay);
+	const FCowAsyncLoadQueue::FRequestId Cancelled = Queue.Request(Path, Waiter(TEXT("Cancelled")), ECowLoadPriority::Critical);
+	Queue.Request(Path, Waiter(TEXT("Critical")), ECowLoadPriority::Critical);
+	Queue.Cancel(Cancelled);
+
+	TestTrue(TEXT("Waiters are never called from inside Request"), Calls.IsEmpty());
+	TestEqual(TEXT("Requests for the same path share a single load"), Queue.NumPendingLoads(), PendingBefore + 1);
+
+	FTSTicker::GetCoreTicker().Tick(0.f);
+	TestEqual(TEXT("Critical and Gameplay waiters are called on load in request order, Background ones wait for the next tick"),
+		Calls, TArray<FString>({ TEXT("Gameplay"), TEXT("Critical") }));
+	TestEqual(TEXT("Load is finished"), Queue.NumPendingLoads(), PendingBefore);
+
+	FTSTicker::GetCoreTicker().Tick(0.f);
+	TestEqual(TEXT("Background waiters are called after everything else, cancelled one never is"),
+		Calls, TArray<FString>({ TEXT("Gameplay"), TEXT("Critical"), TEXT("Background") }));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Engine/TargetPoint.h"
+#include "GameFramework/Pawn.h"
+
+// Cow
+#include "CowClassAncestry.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCowClassAncestryTest, "Cow.ClassAncestry.NativeClasses",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCowClassAncestryTest::RunTest(const FString& Parameters)
+{
+	FCowClassAncestry& Ancestry = FCowClassAncestry::Get();
+	Ancestry.InvalidateAll();
+
+	const FSoftObjectPath Object(UObject::StaticClass());
+	const FSoftObjectPath Actor(AActor::StaticClass());
+	const FSoftObjectPath Pawn(APawn::StaticClass());
+	const FSoftObjectPath TargetPoint(ATargetPoint::StaticClass());
+	const FSoftObjectPath Unknown(TEXT("/Game/CowTests/BP_DoesNotExist.BP_DoesNotExist_C"));
+
+	TestTrue(TEXT("Class is a child of itself"), Ancestry.IsChildOf(TargetPoint, TargetPoint));
+	TestTrue(TEXT("Direct parent"), Ancestry.IsChildOf(TargetPoint, Actor));
+	TestTrue(TEXT("Root parent"), Ancestry.IsChildOf(TargetPoint, Object));
+	TestFalse(TEXT("Parent isn't a child"), Ancestry.IsChildOf(Actor, TargetPoint));
+	TestFalse(TEXT("Sibling isn't a child"), Ancestry.IsChildOf(TargetPoint, Pawn));
+	TestFalse(TEXT("Null path isn't a child"), Ancestry.IsChildOf(FSoftObjectPath(), Actor));
+	TestFalse(TEXT("Nothing is a child of null path"), Ancestry.IsChildOf(TargetPoint, FSoftObjectPath()));
+
+	// Candidates are checked in order, the first one that is a parent wins
+	const FSoftObjectPath Candidates[] = { Pawn, Actor, Object };
+	TestEqual(TEXT("First parent among candidates"), Ancestry.FindFirstParent(TargetPoint, Candidates), 1);
+	TestEqual(TEXT("Class itself is a candidate"), Ancestry.FindFirstParent(Pawn, Candidates), 0);
+	TestEqual(TEXT("No candidate is a parent"), Ancestry.FindFirstParent(Object, MakeArrayView(Candidates, 2)), INDEX_NONE);
+	TestEqual(TEXT("No candidates"), Ancestry.FindFirstParent(TargetPoint, {}), INDEX_NONE);
+
+	// Classes share their ancestors' entries, asking again doesn't add anything
+	const int32 NumEntries = Ancestry.Num();
+	TestTrue(TEXT("Table has the classes"), NumEntries > 0);
+	TestEqual(TEXT("Repeated lookup reuses the table"), Ancestry.FindFirstParent(TargetPoint, Candidates), 1);
+	TestEqual(TEXT("Repeated lookup adds no entries"), Ancestry.Num(), NumEntries);
+
+	// Failed lookups aren't cached, the asset could be discovered later
+	TestFalse(TEXT("Unknown class isn't a child"), Ancestry.IsChildOf(Unknown, Actor));
+	TestEqual(TEXT("Unknown class adds no entries"), Ancestry.Num(), NumEntries);
+
+	Ancestry.InvalidateAll();
+	TestEqual(TEXT("InvalidateAll empties the table"), Ancestry.Num(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
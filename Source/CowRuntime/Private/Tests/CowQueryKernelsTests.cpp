@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine
+#include "Camera/CameraTypes.h"
+
+// Cow
+#include "CowQueryKernels.h"
+
+namespace CowQueryKernelsTests
+{
+	using namespace Cow::Kernels;
+
+	// Positions the SIMD and scalar versions are compared on, every test is also checked against double precision math
+	struct FPositionArrays
+	{
+		TArray<float> X;
+		TArray<float> Y;
+		TArray<float> Z;
+		TArray<float> Radius;
+
+		FPositions Get() const { return { X.GetData(), Y.GetData(), Z.GetData(), Radius.GetData(), X.Num() }; }
+
+		void Add(const FVector3f& Position, float InRadius)
+		{
+			X.Add(Position.X);
+			Y.Add(Position.Y);
+			Z.Add(Position.Z);
+			Radius.Add(InRadius);
+		}
+	};
+
+	// Signed distance-like margin of Position to the shape surface, positive inside
+	double GetMargin(const FSphere& Shape, const FVector3d& Position, double Radius)
+	{
+		return Shape.Radius - FVector3d::Dist(Position, FVector3d(Shape.Center));
+	}
+
+	double GetMargin(const FBox& Shape, const FVector3d& Position, double Radius)
+	{
+		const FVector3d ToMin = Position - FVector3d(Shape.Min);
+		const FVector3d ToMax = FVector3d(Shape.Max) - Position;
+		return FMath::Min(ToMin.GetMin(), ToMax.GetMin());
+	}
+
+	double GetMargin(const FCone& Shape, const FVector3d& Position, double Radius)
+	{
+		const FVector3d ToPosition = Position - FVector3d(Shape.Apex);
+		const double Dot = ToPosition.Dot(FVector3d(Shape.Direction));
+		const double Angle = FMath::Acos(FMath::Clamp(Dot / FMath::Max(ToPosition.Size(), UE_DOUBLE_SMALL_NUMBER), -1.0, 1.0));
+		// Angle margin scaled to a distance, so one threshold works for every term
+		return FMath::Min3(Dot, Shape.Length - Dot, (Shape.HalfAngleRadians - Angle) * ToPosition.Size());
+	}
+
+	double GetMargin(const FFrustum& Shape, const FVector3d& Position, double Radius)
+	{
+		double Margin = UE_DOUBLE_BIG_NUMBER;
+		for (const FPlane4f& Plane : Shape.Planes)
+		{
+			Margin = FMath::Min(Margin, Radius - (FVector3d(Plane.X, Plane.Y, Plane.Z).Dot(Position) - Plane.W));
+		}
+		return Margin;
+	}
+
+	/**
+	 * Random positions around the shape plus unplaced ones, positions closer to the surface than float precision can tell
+	 * are dropped (the two versions may round them differently and both would be right)
+	 */
+	template<typename ShapeType>
+	FPositionArrays MakePositions(const ShapeType& Shape, int32 Num, FRandomStream& Random, TArray<bool>& OutExpected)
+	{
+		FPositionArrays Positions;
+		while (Positions.X.Num() < Num)
+		{
+			if (Random.FRand() < 0.1f)
+			{
+				Positions.Add(FVector3f(UnplacedCoordinate), UnplacedRadius);
+				OutExpected.Add(false);
+				continue;
+			}
+
+			const FVector3d Position(Random.FRandRange(-2000.0, 2000.0), Random.FRandRange(-2000.0, 2000.0), Random.FRandRange(-2000.0, 2000.0));
+			const double Radius = Random.FRandRange(0.0, 200.0);
+			const double Margin = GetMargin(Shape, Position, Radius);
+			if (FMath::Abs(Margin) < 0.5)
+			{
+				continue;
+			}
+			Positions.Add(FVector3f(Position), Radius);
+			OutExpected.Add(Margin > 0.0);
+		}
+		return Positions;
+	}
+
+	template<typename ShapeType>
+	void TestShape(FAutomationTestBase& Test, const TCHAR* ShapeName, const ShapeType& Shape)
+	{
+		FRandomStream Random(1234);
+
+		// Lane tails of every length, an exact multiple of 4 and a big one
+		for (const int32 Num : { 0, 1, 2, 3, 4, 5, 7, 8, 64, 1001 })
+		{
+			TArray<bool> Expected;
+			const FPositionArrays Positions = MakePositions(Shape, Num, Random, Expected);
+
+			TArray<int32> ExpectedIndices;
+			for (int32 Index = 0; Index < Expected.Num(); ++Index)
+			{
+				if (Expected[Index])
+				{
+					ExpectedIndices.Add(Index);
+				}
+			}
+
+			TArray<int32> ScalarIndices;
+			ScalarIndices.SetNumUninitialized(Num);
+			ScalarIndices.SetNum(Scalar::Filter(Positions.Get(), Shape, ScalarIndices.GetData()));
+
+			TArray<int32> SimdIndices;
+			SimdIndices.SetNumUninitialized(Num);
+			SimdIndices.SetNum(Filter(Positions.Get(), Shape, SimdIndices.GetData()));
+
+			Test.TestEqual(FString::Printf(TEXT("%s, %d positions: scalar matches the reference"), ShapeName, Num), ScalarIndices, ExpectedIndices);
+			Test.TestEqual(FString::Printf(TEXT("%s, %d positions: SIMD matches scalar"), ShapeName, Num), SimdIndices, ScalarIndices);
+
+			// Block filtering gives the same indices
+			TArray<int32> BlockIndices;
+			ForEachInside(Positions.Get(), Shape, [&BlockIndices](int32 Index) { BlockIndices.Add(Index); });
+			Test.TestEqual(FString::Printf(TEXT("%s, %d positions: ForEachInside matches scalar"), ShapeName, Num), BlockIndices, ScalarIndices);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCowQueryKernelsTest, "Cow.QueryKernels.SimdMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCowQueryKernelsTest::RunTest(const FString& Parameters)
+{
+	using namespace CowQueryKernelsTests;
+
+	TestShape(*this, TEXT("Sphere"), MakeSphere(FVector(100.0, -200.0, 50.0), 900.0));
+	TestShape(*this, TEXT("Box"), MakeBox(FVector(-100.0, 300.0, 0.0), FVector(700.0, 400.0, 1200.0)));
+	TestShape(*this, TEXT("Cone"), MakeCone(FVector(-1500.0, 0.0, 0.0), FVector(1.0, 0.5, -0.2), 2500.0, 30.0));
+
+	FMinimalViewInfo View;
+	View.Location = FVector(-1800.0, 100.0, 0.0);
+	View.Rotation = FRotator(10.0, 20.0, 0.0);
+	View.FOV = 70.f;
+	View.AspectRatio = 16.f / 9.f;
+	TestShape(*this, TEXT("Frustum"), MakeFrustum(View));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
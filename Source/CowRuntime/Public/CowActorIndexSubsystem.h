@@ -0,0 +1,441 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CowQueryKernels.h"
+#include "CowActorIndexSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+
+// Queries memoized per frame by UCowActorIndexSubsystem::FindOrQueryActors
+enum class ECowActorQuery : uint8
+{
+	AllActors,
+	// At most one actor
+	FirstActor,
+};
+
+template<typename T>
+class TCowActorView;
+
+/**
+ * Actors of one class bucket with their positions, arrays are parallel (structure of arrays)
+ * Actors destroyed during iteration are nullptr and parked far away (see Cow::Kernels::UnplacedCoordinate),
+ * so shape tests skip them without a check
+ */
+template<typename T>
+struct TCowActorChunk
+{
+	TArrayView<AActor* const> Actors;
+	TArrayView<const float> X;
+	TArrayView<const float> Y;
+	TArrayView<const float> Z;
+	// Bounds sphere radius of the root component measured from its location
+	TArrayView<const float> Radius;
+
+	int32 Num() const { return Actors.Num(); }
+	T* GetActor(int32 Index) const { return static_cast<T*>(Actors[Index]); }
+
+	Cow::Kernels::FPositions GetPositions() const
+	{
+		return { X.GetData(), Y.GetData(), Z.GetData(), Radius.GetData(), Num() };
+	}
+};
+
+/**
+ * Actors of the world bucketed by their exact class, for native queries (see TCowActorView and Cow::ForEachActor)
+ *
+ * Query for a class walks buckets of the class and its children, list of those buckets is cached per queried class,
+ * so the hot loop is a plain walk over actor pointers: no casts, no output array, no delegate call per actor
+ *
+ * Built on the first query, worlds that never query pay nothing
+ * Kept up to date by actor spawned/destroyed handlers of the world and level added/removed delegates (streaming, world partition cells)
+ *
+ * Every bucket also keeps root component location and bounds radius of its actors in flat float arrays (see TCowActorChunk),
+ * so spatial queries don't chase Actor -> RootComponent -> ComponentToWorld per actor per query
+ * Positions are refreshed once per frame, on the first spatial query of the bucket in that frame, for movable roots and for actors
+ * that weren't finished when added (deferred spawns are added before FinishSpawning, Blueprint roots don't exist until construction),
+ * static ones are dropped from the refresh once they're read after construction. Whatever moves later in the same frame is seen by queries in the next one
+ *
+ * Results of CowGetAllActorsOfClass/CowGetActorOfClass are memoized until the end of the frame (see FindOrQueryActors)
+ */
+UCLASS()
+class COWRUNTIME_API UCowActorIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UCowActorIndexSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	// Number of indexed actors, 0 until the first query
+	int32 NumActors() const { return ActorToIndex.Num(); }
+
+	/**
+	 * Actors of Class (and its children), the first call in a frame walks the index, the following ones get the same array back
+	 * Memoized result is dropped at the end of the frame or once an actor of Class is added or removed, the array itself
+	 * never changes so callers may hold on to it (actors in it may be destroyed by then). OutActorsScanned is 0 for memoized results
+	 * cow.QueryMemo.Enable 0 makes every call walk the index
+	 */
+	TSharedRef<const TArray<AActor*>> FindOrQueryActors(const UClass* Class, ECowActorQuery Query, int32& OutActorsScanned);
+
+	// Drops memoized query results, happens at the end of every frame
+	void FlushQueryMemo();
+
+	// Coordinate of actors without a root component (and of destroyed ones during iteration)
+	static constexpr float UnplacedCoordinate = Cow::Kernels::UnplacedCoordinate;
+
+private:
+	template<typename T>
+	friend class TCowActorView;
+
+	struct FBucket
+	{
+		const UClass* Class = nullptr;
+		TArray<AActor*> Actors;
+
+		// Parallel to Actors
+		TArray<float> X;
+		TArray<float> Y;
+		TArray<float> Z;
+		TArray<float> Radius;
+		// Positions RefreshPositions re-reads, see IsPositionFinal
+		TBitArray<> Refresh;
+		uint64 PositionsFrame = MAX_uint64;
+
+		int32 Add(AActor* Actor);
+		void RemoveAtSwap(int32 Index);
+		void Park(int32 Index);
+		// Removes nullptr actors, false if there were none
+		bool Compact();
+		void ReadPosition(int32 Index);
+		// Static root of a constructed actor, won't move (SetMobility at runtime isn't tracked)
+		static bool IsPositionFinal(const AActor* Actor);
+	};
+
+	// Bucket index and number of actors in it when the iteration started
+	using FBucketRanges = TArray<TPair<int32, int32>, TInlineAllocator<8>>;
+
+	const TArray<int32, TInlineAllocator<8>>& GetClassBuckets(const UClass* Class);
+	void BeginIteration(const UClass* Class, FBucketRanges& OutRanges);
+	void EndIteration();
+	void RefreshPositions(int32 BucketIndex);
+
+	void Build();
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+	void RemoveBucket(int32 BucketIndex);
+	void Compact();
+	void InvalidateQueryMemo(const AActor* Actor);
+
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDestroyed(AActor* Actor);
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+	void OnLevelRemoved(ULevel* Level, UWorld* World);
+	void OnEndFrame();
+
+	// Where the actor is, bucket is stored rather than looked up by class so a removal never depends on GetClass()
+	// of an actor that may be half destroyed or reinstanced
+	struct FActorSlot
+	{
+		int32 Bucket = INDEX_NONE;
+		int32 Index = INDEX_NONE;
+	};
+
+	TArray<FBucket> Buckets;
+	TMap<TObjectKey<UClass>, int32> ClassToBucket;
+	TMap<const AActor*, FActorSlot> ActorToIndex;
+
+	// Buckets of the queried class and its children, reset whenever a bucket is added or removed
+	TMap<TObjectKey<UClass>, TArray<int32, TInlineAllocator<8>>> QueryCache;
+
+	struct FMemoizedQuery
+	{
+		const UClass* Class = nullptr;
+		TSharedRef<const TArray<AActor*>> Actors;
+	};
+
+	// Valid for QueryMemoFrame only, frame check covers worlds ticked without the engine loop (commandlets)
+	TMap<TPair<TObjectKey<UClass>, ECowActorQuery>, FMemoizedQuery> QueryMemo;
+	uint64 QueryMemoFrame = MAX_uint64;
+
+	// Actors removed while iterating are nulled and compacted once the last view is gone, so indices stay valid
+	// Actors added while iterating wait in PendingAdds, so bucket arrays are never reallocated under a view
+	TArray<AActor*> PendingAdds;
+	int32 IterationDepth = 0;
+	bool bNeedsCompaction = false;
+	bool bBuilt = false;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle EndFrameHandle;
+};
+
+/**
+ * Range over actors of T (and its children) in the world
+ *
+ *	for (AMyPawn* Pawn : TCowActorView<AMyPawn>(this))
+ *
+ * Actors spawned while iterating aren't visited, destroyed ones are skipped
+ * Meant to live on the stack for the duration of the loop
+ */
+template<typename T>
+class TCowActorView
+{
+	static_assert(std::is_base_of_v<AActor, T>, "TCowActorView works with actors only");
+
+public:
+	// Class is T, resolved at compile time
+	explicit TCowActorView(const UObject* WorldContextObject)
+		: TCowActorView(WorldContextObject, T::StaticClass())
+	{
+	}
+
+	// Soft class that isn't loaded has no instances, the view is empty then (TSoftClassPtr<T>::Get also makes sure it's a T)
+	TCowActorView(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass)
+		: TCowActorView(WorldContextObject, SoftClass.Get())
+	{
+	}
+
+	~TCowActorView()
+	{
+		if (Index)
+		{
+			Index->EndIteration();
+		}
+	}
+
+	TCowActorView(const TCowActorView&) = delete;
+	TCowActorView& operator=(const TCowActorView&) = delete;
+
+	class FIterator
+	{
+	public:
+		FIterator(const TCowActorView& InView, int32 InRange)
+			: View(InView)
+			, Range(InRange)
+		{
+			SkipRemoved();
+		}
+
+		T* operator*() const
+		{
+			return static_cast<T*>(View.Index->Buckets[View.Ranges[Range].Key].Actors[Actor]);
+		}
+
+		FIterator& operator++()
+		{
+			++Actor;
+			SkipRemoved();
+			return *this;
+		}
+
+		bool operator!=(const FIterator& Other) const
+		{
+			return Range != Other.Range || Actor != Other.Actor;
+		}
+
+	private:
+		void SkipRemoved()
+		{
+			for (; Range < View.Ranges.Num(); ++Range, Actor = 0)
+			{
+				const TArray<AActor*>& Actors = View.Index->Buckets[View.Ranges[Range].Key].Actors;
+				const int32 Num = View.Ranges[Range].Value;
+				for (; Actor < Num; ++Actor)
+				{
+					if (Actors[Actor])
+					{
+						return;
+					}
+				}
+			}
+		}
+
+		const TCowActorView& View;
+		int32 Range = 0;
+		int32 Actor = 0;
+	};
+
+	FIterator begin() const { return FIterator(*this, 0); }
+	FIterator end() const { return FIterator(*this, Ranges.Num()); }
+
+	// Calls Func(const TCowActorChunk<T>&) for every class bucket of the view, positions are refreshed if they weren't this frame
+	// Chunk stays valid for the whole call, actors spawned by Func are added to buckets only once the last view is gone
+	template<typename FuncType>
+	void ForEachChunk(FuncType&& Func) const
+	{
+		for (const TPair<int32, int32>& Range : Ranges)
+		{
+			Index->RefreshPositions(Range.Key);
+			const UCowActorIndexSubsystem::FBucket& Bucket = Index->Buckets[Range.Key];
+
+			TCowActorChunk<T> Chunk;
+			Chunk.Actors = MakeArrayView(Bucket.Actors.GetData(), Range.Value);
+			Chunk.X = MakeArrayView(Bucket.X.GetData(), Range.Value);
+			Chunk.Y = MakeArrayView(Bucket.Y.GetData(), Range.Value);
+			Chunk.Z = MakeArrayView(Bucket.Z.GetData(), Range.Value);
+			Chunk.Radius = MakeArrayView(Bucket.Radius.GetData(), Range.Value);
+			Func(Chunk);
+		}
+	}
+
+private:
+	TCowActorView(const UObject* WorldContextObject, const UClass* Class)
+	{
+		if (Class)
+		{
+			Index = UCowActorIndexSubsystem::Get(WorldContextObject);
+			if (Index)
+			{
+				Index->BeginIteration(Class, Ranges);
+			}
+		}
+	}
+
+	UCowActorIndexSubsystem* Index = nullptr;
+	UCowActorIndexSubsystem::FBucketRanges Ranges;
+};
+
+namespace Cow
+{
+	namespace Private
+	{
+		template<typename T, typename FuncType>
+		void ForEachActorInView(const TCowActorView<T>& View, FuncType& Func)
+		{
+			for (T* Actor : View)
+			{
+				if constexpr (std::is_same_v<decltype(Invoke(Func, *Actor)), bool>)
+				{
+					if (!Invoke(Func, *Actor))
+					{
+						return;
+					}
+				}
+				else
+				{
+					Invoke(Func, *Actor);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Calls Func(T&) for every actor of T (and its children) in the world, Func may return false to stop
+	 *
+	 *	Cow::ForEachActor<AMyPawn>(this, [](AMyPawn& Pawn) { Pawn.Heal(); });
+	 */
+	template<typename T, typename FuncType>
+	void ForEachActor(const UObject* WorldContextObject, FuncType&& Func)
+	{
+		Private::ForEachActorInView(TCowActorView<T>(WorldContextObject), Func);
+	}
+
+	// Same for a soft class, nothing is called if it isn't loaded (no instances can exist then)
+	template<typename T, typename FuncType>
+	void ForEachActor(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass, FuncType&& Func)
+	{
+		Private::ForEachActorInView(TCowActorView<T>(WorldContextObject, SoftClass), Func);
+	}
+
+	namespace Private
+	{
+		// Unplaced actors must never pass a distance test, not even with a "whole world" radius
+		inline float ClampDistanceSquared(float Distance)
+		{
+			return FMath::Min(Distance * Distance, FMath::Square(UCowActorIndexSubsystem::UnplacedCoordinate));
+		}
+
+		template<typename T, typename ShapeType, typename FuncType>
+		void ForEachActorInShape(const TCowActorView<T>& View, const ShapeType& Shape, FuncType& Func)
+		{
+			View.ForEachChunk([&Shape, &Func](const TCowActorChunk<T>& Chunk)
+			{
+				Cow::Kernels::ForEachInside(Chunk.GetPositions(), Shape, [&Chunk, &Func](int32 Index)
+				{
+					// Block is filtered before Func runs, Func may have destroyed a later actor of the block since
+					if (T* Actor = Chunk.GetActor(Index))
+					{
+						Func(*Actor);
+					}
+				});
+			});
+		}
+
+		template<typename T>
+		T* FindNearestActor(const TCowActorView<T>& View, const FVector& Origin, float MaxDistance)
+		{
+			const FVector3f Origin3f(Origin);
+			float BestDistanceSquared = ClampDistanceSquared(MaxDistance);
+			T* BestActor = nullptr;
+			View.ForEachChunk([&Origin3f, &BestDistanceSquared, &BestActor](const TCowActorChunk<T>& Chunk)
+			{
+				for (int32 Index = 0; Index < Chunk.Num(); ++Index)
+				{
+					const float DX = Chunk.X[Index] - Origin3f.X;
+					const float DY = Chunk.Y[Index] - Origin3f.Y;
+					const float DZ = Chunk.Z[Index] - Origin3f.Z;
+					const float DistanceSquared = DX * DX + DY * DY + DZ * DZ;
+					if (DistanceSquared < BestDistanceSquared)
+					{
+						BestDistanceSquared = DistanceSquared;
+						BestActor = Chunk.GetActor(Index);
+					}
+				}
+			});
+			return BestActor;
+		}
+	}
+
+	/**
+	 * Spatial queries over positions kept by UCowActorIndexSubsystem (root component location, as of the first query this frame)
+	 * Float precision, good enough to pick actors, do precise math on the returned actors if needed
+	 */
+
+	// Calls Func(T&) for every actor of T inside Shape (any of Cow::Kernels shapes, e.g. Cow::Kernels::MakeCone(...))
+	template<typename T, typename ShapeType, typename FuncType>
+	void ForEachActorInShape(const UObject* WorldContextObject, const ShapeType& Shape, FuncType&& Func)
+	{
+		Private::ForEachActorInShape(TCowActorView<T>(WorldContextObject), Shape, Func);
+	}
+
+	template<typename T, typename ShapeType, typename FuncType>
+	void ForEachActorInShape(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass, const ShapeType& Shape, FuncType&& Func)
+	{
+		Private::ForEachActorInShape(TCowActorView<T>(WorldContextObject, SoftClass), Shape, Func);
+	}
+
+	// Calls Func(T&) for every actor of T within Radius of Center
+	template<typename T, typename FuncType>
+	void ForEachActorInRadius(const UObject* WorldContextObject, const FVector& Center, float Radius, FuncType&& Func)
+	{
+		Private::ForEachActorInShape(TCowActorView<T>(WorldContextObject), Cow::Kernels::MakeSphere(Center, Radius), Func);
+	}
+
+	template<typename T, typename FuncType>
+	void ForEachActorInRadius(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass, const FVector& Center, float Radius, FuncType&& Func)
+	{
+		Private::ForEachActorInShape(TCowActorView<T>(WorldContextObject, SoftClass), Cow::Kernels::MakeSphere(Center, Radius), Func);
+	}
+
+	// Closest actor of T to Origin within MaxDistance, nullptr if there is none
+	template<typename T>
+	T* FindNearestActor(const UObject* WorldContextObject, const FVector& Origin, float MaxDistance = UE_BIG_NUMBER)
+	{
+		return Private::FindNearestActor(TCowActorView<T>(WorldContextObject), Origin, MaxDistance);
+	}
+
+	template<typename T>
+	T* FindNearestActor(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass, const FVector& Origin, float MaxDistance = UE_BIG_NUMBER)
+	{
+		return Private::FindNearestActor(TCowActorView<T>(WorldContextObject, SoftClass), Origin, MaxDistance);
+	}
+}
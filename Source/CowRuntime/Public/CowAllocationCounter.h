@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace Cow
+{
+	struct FAllocationCount
+	{
+		int64 Allocations = 0;
+		int64 Bytes = 0;
+	};
+
+	/**
+	 * Counts allocations (Malloc and Realloc) of the calling thread while in scope, for performance tests and benchmarks
+	 *
+	 * The first counter wraps GMalloc in a forwarding proxy with a single atomic exchange, the proxy stays for the rest
+	 * of the process: other threads may hold the GMalloc pointer they've just read at any time, so it's never swapped back
+	 * Outside of a counter the proxy costs one thread local read per allocation
+	 * Counters nest, only the innermost one counts
+	 */
+	class COWRUNTIME_API FScopedAllocationCounter
+	{
+	public:
+		explicit FScopedAllocationCounter(FAllocationCount& InResult);
+		~FScopedAllocationCounter();
+
+		FScopedAllocationCounter(const FScopedAllocationCounter&) = delete;
+		FScopedAllocationCounter& operator=(const FScopedAllocationCounter&) = delete;
+
+		// False if GMalloc couldn't be wrapped (e.g. something else swapped it at the same time), nothing is counted then
+		static bool IsAvailable();
+
+	private:
+		FAllocationCount* Previous = nullptr;
+	};
+}
+
+#endif // !UE_BUILD_SHIPPING
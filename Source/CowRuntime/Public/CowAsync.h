@@ -0,0 +1,205 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Engine/EngineTypes.h"
+#include "CowAsyncLoadQueue.h"
+
+class AActor;
+class APlayerController;
+class UUserWidget;
+
+/**
+ * Native counterpart of Cow async nodes: create a widget, spawn an actor or construct an object from a soft class without a hard-ref
+ *
+ *	Cow::CreateWidgetAsync<UMyWidget>(this, MyWidgetClass, [](UMyWidget& Widget) { Widget.Title = ...; })
+ *		.Then([this](UMyWidget* Widget) { Widget->AddToViewport(); });
+ *
+ *	TFuture<AMyActor*> Future = Cow::SpawnActorAsync<AMyActor>(this, MyActorClass, Transform).GetFuture();
+ *
+ * Same path as the nodes: class is loaded through FCowAsyncLoadQueue (requests of the same class are coalesced),
+ * objects are created by the same functions, so stat Cow counters, widget call site stats and trace events
+ * (WidgetLoad*/WidgetCreate for widgets, AsyncRequest for actors and objects) are recorded the same way, with a zero call site GUID
+ * Every request takes an ECowLoadPriority, same as the node setting (spawn and construct nodes always use Gameplay)
+ *
+ * InitFn is executed right after the object is created, where ExposeOnSpawn assignments of the node are:
+ *  - Widget: after CreateWidget, before Then callbacks (AddToViewport is up to you, same as with the node)
+ *  - Actor: between BeginDeferredActorSpawnFromClass and FinishSpawningActor (values are visible in construction script and BeginPlay)
+ *  - Object: after NewObject
+ *
+ * Request completes with nullptr if the class failed to load (or isn't a T) or creation failed
+ * If the owner is gone by the time the class is loaded the request is cancelled (same as the node that simply never completes)
+ * Completion is never called from inside the request itself: already loaded classes complete on the next tick,
+ * a class that has to be loaded completes whenever async loading finishes it, which may still be the same frame (see FCowAsyncLoadQueue)
+ *
+ * Game thread only
+ */
+namespace Cow
+{
+	/**
+	 * Shared by all copies of TAsyncRequest and kept alive by the pending load, so dropping the request doesn't cancel it
+	 */
+	class COWRUNTIME_API FAsyncRequestState
+	{
+	public:
+		using FCallback = TUniqueFunction<void(UObject*)>;
+
+		~FAsyncRequestState();
+
+		bool IsPending() const { return bPending; }
+		bool IsCancelled() const { return bCancelled; }
+		UObject* GetResult() const { return Result.Get(); }
+
+		// Callbacks aren't called, futures are fulfilled with nullptr
+		void Cancel();
+
+		// Called right away if the request is already completed, never if it's cancelled
+		void AddCallback(FCallback Callback);
+		TFuture<UObject*> GetFuture();
+
+		// Used by Cow::Private implementation
+		void Start(const FSoftObjectPath& ClassPath, FCowAsyncLoadQueue::FOnLoaded OnLoaded, ECowLoadPriority Priority);
+		void Complete(UObject* InResult);
+		TUniqueFunction<void()> OnCancelled;
+
+	private:
+		bool bPending = true;
+		bool bCancelled = false;
+		FCowAsyncLoadQueue::FRequestId LoadRequestId = 0;
+		TWeakObjectPtr<UObject> Result;
+		TArray<FCallback> Callbacks;
+		TArray<TPromise<UObject*>> Promises;
+	};
+
+	/**
+	 * Handle of Cow:: async request, cheap to copy
+	 * Default constructed (invalid) handle behaves as a cancelled request
+	 */
+	template<typename T>
+	class TAsyncRequest
+	{
+	public:
+		TAsyncRequest() = default;
+		explicit TAsyncRequest(TSharedPtr<FAsyncRequestState> InState)
+			: State(MoveTemp(InState))
+		{
+		}
+
+		bool IsValid() const { return State.IsValid(); }
+		bool IsPending() const { return State.IsValid() && State->IsPending(); }
+		T* GetResult() const { return State.IsValid() ? Cast<T>(State->GetResult()) : nullptr; }
+
+		void Cancel()
+		{
+			if (State.IsValid())
+			{
+				State->Cancel();
+			}
+		}
+
+		// Executed on game thread with the created object (or nullptr), never if the request is cancelled
+		TAsyncRequest& Then(TUniqueFunction<void(T*)> Callback)
+		{
+			if (State.IsValid())
+			{
+				State->AddCallback([Callback = MoveTemp(Callback)](UObject* Object) mutable { Callback(Cast<T>(Object)); });
+			}
+			return *this;
+		}
+
+		// Fulfilled on game thread with the created object or nullptr (including cancellation), don't block the game thread on it
+		// @note: Future holds a raw pointer, the object isn't kept alive by it
+		TFuture<T*> GetFuture() const
+		{
+			if (!State.IsValid())
+			{
+				return MakeFulfilledPromise<T*>(nullptr).GetFuture();
+			}
+			return State->GetFuture().Next([](UObject* Object) { return Cast<T>(Object); });
+		}
+
+	private:
+		TSharedPtr<FAsyncRequestState> State;
+	};
+
+	struct FSpawnActorAsyncParams
+	{
+		ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::Undefined;
+		ESpawnActorScaleMethod TransformScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot;
+		AActor* Owner = nullptr;
+	};
+
+	namespace Private
+	{
+		COWRUNTIME_API TSharedRef<FAsyncRequestState> CreateWidgetAsync(UObject* Owner, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+			TFunction<void(UObject&)> InitFn, APlayerController* OwningPlayer, ECowLoadPriority Priority);
+		COWRUNTIME_API TSharedRef<FAsyncRequestState> SpawnActorAsync(UObject* WorldContextObject, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+			const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params, TFunction<void(UObject&)> InitFn, ECowLoadPriority Priority);
+		COWRUNTIME_API TSharedRef<FAsyncRequestState> ConstructObjectAsync(UObject* Outer, const FSoftObjectPath& ClassPath, UClass* BaseClass,
+			TFunction<void(UObject&)> InitFn, ECowLoadPriority Priority);
+
+		template<typename T>
+		TFunction<void(UObject&)> WrapInitFn(TFunction<void(T&)>&& InitFn)
+		{
+			if (!InitFn)
+			{
+				return nullptr;
+			}
+			return [InitFn = MoveTemp(InitFn)](UObject& Object) { InitFn(*CastChecked<T>(&Object)); };
+		}
+
+		// Work shared by Cow nodes and Cow:: API, so both are measured the same way
+
+		/**
+		 * Stats and trace of a single widget request (see FCowCallSiteStats)
+		 */
+		class COWRUNTIME_API FWidgetRequestTracker
+		{
+		public:
+			void Start(const FGuid& InNodeGuid, const UObject* Caller, const FSoftObjectPath& InClassPath);
+			// Creates the widget (nullptr Class is fine, result is nullptr then) and records completion
+			UUserWidget* Create(UObject* Context, UClass* Class, APlayerController* OwningPlayer);
+			// Request is destroyed before completion
+			void Cancel();
+
+		private:
+			FGuid NodeGuid;
+			FSoftObjectPath ClassPath;
+			// Call site of the stats, caller is usually gone when the request is cancelled
+			TWeakObjectPtr<const UClass> CallerClass;
+			// Non zero while the request is in flight
+			uint64 RequestCycle = 0;
+		};
+
+		// Deferred spawn pair stock SpawnActorFromClass expands to
+		COWRUNTIME_API AActor* BeginSpawnActor(UObject* Context, UClass* Class, const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params);
+		COWRUNTIME_API AActor* FinishSpawnActor(AActor* Actor, const FTransform& SpawnTransform, const FSpawnActorAsyncParams& Params);
+
+		// UGameplayStatics::SpawnObject, same as stock ConstructObjectFromClass
+		COWRUNTIME_API UObject* ConstructObject(UClass* Class, UObject* Outer);
+	}
+
+	// Priority is the same as the node setting (see ECowLoadPriority)
+	template<typename T = UUserWidget>
+	TAsyncRequest<T> CreateWidgetAsync(UObject* Owner, TSoftClassPtr<T> SoftClass, TFunction<void(T&)> InitFn = nullptr, APlayerController* OwningPlayer = nullptr,
+		ECowLoadPriority Priority = ECowLoadPriority::Gameplay)
+	{
+		return TAsyncRequest<T>(Private::CreateWidgetAsync(Owner, SoftClass.ToSoftObjectPath(), T::StaticClass(), Private::WrapInitFn<T>(MoveTemp(InitFn)), OwningPlayer, Priority));
+	}
+
+	template<typename T = AActor>
+	TAsyncRequest<T> SpawnActorAsync(UObject* WorldContextObject, TSoftClassPtr<T> SoftClass, const FTransform& SpawnTransform,
+		TFunction<void(T&)> InitFn = nullptr, const FSpawnActorAsyncParams& Params = FSpawnActorAsyncParams(), ECowLoadPriority Priority = ECowLoadPriority::Gameplay)
+	{
+		return TAsyncRequest<T>(Private::SpawnActorAsync(WorldContextObject, SoftClass.ToSoftObjectPath(), T::StaticClass(), SpawnTransform, Params,
+			Private::WrapInitFn<T>(MoveTemp(InitFn)), Priority));
+	}
+
+	template<typename T = UObject>
+	TAsyncRequest<T> ConstructObjectAsync(UObject* Outer, TSoftClassPtr<T> SoftClass, TFunction<void(T&)> InitFn = nullptr, ECowLoadPriority Priority = ECowLoadPriority::Gameplay)
+	{
+		return TAsyncRequest<T>(Private::ConstructObjectAsync(Outer, SoftClass.ToSoftObjectPath(), T::StaticClass(), Private::WrapInitFn<T>(MoveTemp(InitFn)), Priority));
+	}
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "CowAsyncLoadQueue.generated.h"
+
+/**
+ * Who's waiting for the load, decides FStreamableManager priority and when the object is created once the class is loaded
+ */
+UENUM(BlueprintType)
+enum class ECowLoadPriority : uint8
+{
+	// Player is looking at the spot where it's going to appear (HUD, hit reactions), loaded with AsyncLoadHighPriority
+	Critical,
+	// Anything else during gameplay, default streamable priority
+	Gameplay,
+	// Menus and preloads nobody is waiting for yet, loaded below default priority and created after everything else,
+	// held back while frames are slower than cow.LoadQueue.BackgroundPauseFrameMs
+	Background,
+};
+
+/**
+ * Class loads of Cow async nodes and Cow:: C++ API (see CowAsync.h) go through here
+ *
+ * Requests for the same path issued while it's still loading share a single load, so 50 CowCreateWidgetAsync of the same class
+ * in a frame is one streamable request and one completion fanned out to 50 waiters
+ * If a more important request joins a load in flight, the path is requested again with the higher priority
+ * (async loader bumps packages that are already loading), waiters still get a single completion
+ *
+ * Waiters of a load are called in request order and never from inside Request itself
+ * Already loaded classes and null paths complete on the next tick (same 1 frame delay LoadAsset has),
+ * a class that has to be loaded completes whenever async loading finishes it, which may still be the same frame
+ * (async loading processed later in the frame, FlushAsyncLoading, a blocking load of the same package)
+ * Critical and Gameplay waiters are called as soon as the class is loaded, Background ones go to the post-load queue
+ * drained on the next tick, so menus are constructed after whatever gameplay needed that frame
+ *
+ * Handle is released right after the waiters are called, whoever needs the class has it by then
+ * (Background waiters hold on to it until the post-load queue runs them)
+ *
+ * Game thread only
+ */
+class COWRUNTIME_API FCowAsyncLoadQueue
+{
+public:
+	using FRequestId = uint64;
+	using FOnLoaded = TUniqueFunction<void()>;
+
+	static FCowAsyncLoadQueue& Get();
+	// nullptr after Shutdown, for cancellation from destructors that may run that late
+	static FCowAsyncLoadQueue* TryGet();
+	static void Shutdown();
+
+	static int32 GetStreamablePriority(ECowLoadPriority Priority);
+
+	~FCowAsyncLoadQueue();
+
+	FRequestId Request(const FSoftObjectPath& Path, FOnLoaded OnLoaded, ECowLoadPriority Priority = ECowLoadPriority::Gameplay);
+
+	// OnLoaded of the request won't be called, the load itself is cancelled once nobody waits for it
+	// No-op for finished, cancelled or unknown requests (including the one being completed right now)
+	void Cancel(FRequestId RequestId);
+
+	// Paths currently loading (or waiting for the next tick)
+	int32 NumPendingLoads() const { return PendingLoads.Num(); }
+
+private:
+	FCowAsyncLoadQueue() = default;
+
+	void StartLoad(const FSoftObjectPath& Path, ECowLoadPriority Priority);
+	void OnLoaded(FSoftObjectPath Path);
+	bool CompleteDeferred(float DeltaTime);
+	bool TickBackground(float DeltaTime);
+	void StartBackgroundTicker();
+	void UpdateBackgroundStat() const;
+
+	struct FWaiter
+	{
+		FRequestId RequestId;
+		FOnLoaded OnLoaded;
+		ECowLoadPriority Priority;
+		// Set in the post-load queue, keeps the loaded class from being collected while the queue is held
+		TSharedPtr<FStreamableHandle> Handle;
+	};
+
+	struct FPendingLoad
+	{
+		// More than one if the load was requested again with a higher priority
+		TArray<TSharedPtr<FStreamableHandle>, TInlineAllocator<1>> Handles;
+		TArray<FWaiter> Waiters;
+		// Most important of the waiters
+		ECowLoadPriority Priority = ECowLoadPriority::Background;
+	};
+
+	TMap<FSoftObjectPath, FPendingLoad> PendingLoads;
+	TMap<FRequestId, FSoftObjectPath> RequestToPath;
+	FRequestId NextRequestId = 1;
+
+	// Loads without a streamable handle (null path or streamable manager refused the request), completed on the next tick
+	TArray<FSoftObjectPath> DeferredPaths;
+	FTSTicker::FDelegateHandle DeferredTickHandle;
+
+	// Background loads not requested yet because frames were over budget, and Background waiters whose class is loaded
+	TArray<FSoftObjectPath> HeldPaths;
+	TArray<FWaiter> PostLoadQueue;
+	FTSTicker::FDelegateHandle BackgroundTickHandle;
+};
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Soft class -> parent soft class table, answers IsChildOf without loading Blueprint classes
+ *
+ * Parent of an unloaded Blueprint class is read from asset registry ParentClassPath tag
+ * (NativeParentClassPath if the direct parent isn't there, which skips intermediate Blueprint parents),
+ * the same tags UK2Node_CowGetAllActorsOfClass uses in editor. Loaded classes (natives included) just use GetSuperClass
+ *
+ * Table is compact: every class is a single entry (path + index of the parent entry), filled lazily on the first question
+ * and shared by all classes with the same ancestors. It's dropped on any asset registry add/remove/rename
+ * (entries point at each other, so per package invalidation isn't worth it) and when Blueprints are recompiled in editor
+ * Failed lookups are never cached (asset could simply not be discovered yet)
+ *
+ * Game thread only
+ */
+class COWRUNTIME_API FCowClassAncestry
+{
+public:
+	static FCowClassAncestry& Get();
+	static void Shutdown();
+
+	~FCowClassAncestry();
+
+	// Class == ParentClass counts as a child, same as UClass::IsChildOf
+	bool IsChildOf(const FSoftObjectPath& ClassPath, const FSoftObjectPath& ParentClassPath);
+
+	// Index of the first of Candidates which ClassPath is child of, INDEX_NONE if none
+	int32 FindFirstParent(const FSoftObjectPath& ClassPath, TConstArrayView<FSoftObjectPath> Candidates);
+
+	void InvalidateAll();
+
+	int32 Num() const { return Paths.Num(); }
+
+private:
+	FCowClassAncestry();
+
+	// INDEX_NONE if class isn't loaded and asset registry knows nothing about it
+	int32 FindOrAddEntry(const FSoftObjectPath& ClassPath);
+	// Entry of ClassPath and all of its parents, closest first
+	using FAncestry = TArray<int32, TInlineAllocator<32>>;
+	void GetAncestry(const FSoftObjectPath& ClassPath, FAncestry& OutEntries);
+	// Parent wasn't discovered when the entry was added, try again
+	void RetryParent(int32 Entry);
+
+	// Returns false if the class is unknown, OutParentPath is null for root classes
+	static bool ResolveParentClassPath(const FSoftObjectPath& ClassPath, FSoftObjectPath& OutParentPath);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+#if WITH_EDITOR
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+#endif
+
+	static constexpr int32 UnresolvedParent = -2;
+
+	// Entry is the index in both arrays, parent is INDEX_NONE for root classes
+	TArray<FSoftObjectPath> Paths;
+	TArray<int32> Parents;
+	TMap<FSoftObjectPath, int32> PathToEntry;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnFilesLoadedHandle;
+#if WITH_EDITOR
+	FDelegateHandle OnObjectsReplacedHandle;
+#endif
+};
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CowAsyncLoadQueue.h"
+#include "CowConstructObjectAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnObjectConstructed, UObject*, Object);
+
+/**
+ * Runtime part of UK2Node_CowConstructObjectAsync
+ *
+ * Loads the class and constructs the object with UGameplayStatics::SpawnObject (same as stock ConstructObjectFromClass)
+ * ExposeOnSpawn assignments are generated by the node after Completed
+ */
+UCLASS()
+class COWRUNTIME_API UCowConstructObjectAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// Outer defaults to WorldContextObject (the caller) the same way unconnected Outer pin of ConstructObjectFromClass defaults to self
+	// NodeGuid is the GUID of UK2Node_CowConstructObjectAsync that issued the call, used only for profiling (see CowTrace.h)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Object", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowConstructObjectAsyncAction* CowConstructObjectAsync(UObject* WorldContextObject, TSoftClassPtr<UObject> ObjectClass, UObject* Outer, FGuid NodeGuid);
+
+	virtual void Activate() override;
+	virtual void BeginDestroy() override;
+
+	// Object is nullptr if the class failed to load or can't be constructed (see UGameplayStatics::CanSpawnObjectOfClass)
+	UPROPERTY(BlueprintAssignable)
+	FCowOnObjectConstructed Completed;
+
+private:
+	void OnObjectClassLoaded();
+
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TSoftClassPtr<UObject> ObjectClass;
+	TWeakObjectPtr<UObject> Outer;
+	FCowAsyncLoadQueue::FRequestId LoadRequestId = 0;
+	FGuid NodeGuid;
+	// Activation time, start of Cow.AsyncRequest trace event
+	uint64 RequestCycle = 0;
+};
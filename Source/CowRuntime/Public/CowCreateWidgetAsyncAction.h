@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CowAsync.h"
+#include "UObject/ObjectKey.h"
+#include "CowCreateWidgetAsyncAction.generated.h"
+
+class APlayerController;
+class UUserWidget;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnWidgetCreated, UUserWidget*, Widget);
+
+/**
+ * Runtime part of UK2Node_CowCreateWidgetAsync (compact code generation)
+ *
+ * Does natively what LoadAsset -> Conv_ObjectToClass -> UWidgetBlueprintLibrary::Create chain did in the expanded graph
+ * ExposeOnSpawn assignments are still generated by the node after Completed
+ * Class load and widget creation are shared with Cow::CreateWidgetAsync (see CowAsync.h)
+ *
+ * Same as the LoadAsset latent action it replaces, executions of a node (NodeGuid) while its request for the same
+ * WorldContextObject is pending are dropped, so N executions during the load still create one widget
+ * Action is registered with the game instance, without one (e.g. editor utility widgets) it's rooted until completion
+ */
+UCLASS()
+class COWRUNTIME_API UCowCreateWidgetAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// NodeGuid is the GUID of UK2Node_CowCreateWidgetAsync that issued the call, used only for profiling (see CowTrace.h)
+	// Priority comes from the node setting (see ECowLoadPriority)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Widget", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowCreateWidgetAsyncAction* CowCreateWidgetAsync(UObject* WorldContextObject, TSoftClassPtr<UUserWidget> WidgetClass, APlayerController* OwningPlayer, FGuid NodeGuid = FGuid(),
+		ECowLoadPriority Priority = ECowLoadPriority::Gameplay);
+
+	virtual void Activate() override;
+	virtual void BeginDestroy() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FCowOnWidgetCreated Completed;
+
+private:
+	void OnWidgetClassLoaded();
+	// SetReadyToDestroy, also releases the root and the pending request of the node
+	void Finish();
+	void ReleasePendingForNode();
+
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TSoftClassPtr<UUserWidget> WidgetClass;
+	TWeakObjectPtr<APlayerController> OwningPlayer;
+	FCowAsyncLoadQueue::FRequestId LoadRequestId = 0;
+	ECowLoadPriority Priority = ECowLoadPriority::Gameplay;
+	FGuid NodeGuid;
+	// Key of the pending request of (WorldContextObject, NodeGuid) this action holds, WorldContextObject may be gone by the time it's released
+	FObjectKey PendingOwner;
+	bool bPendingForNode = false;
+
+	Cow::Private::FWidgetRequestTracker Tracker;
+};
@@ -5,15 +5,89 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "CowFunctionLibrary.generated.h"
 
+class APlayerController;
+class UUserWidget;
+
+UENUM(BlueprintType)
+enum class ECowQueryShapeType : uint8
+{
+	Sphere,
+	Box,
+	Cone,
+	Frustum
+};
+
+/**
+ * Shape of CowGetAllActorsOfClassInShape (see Cow::Kernels for the math)
+ * Sphere, box and cone test actor location, frustum tests actor bounds the same way view culling does
+ */
+USTRUCT(BlueprintType)
+struct COWRUNTIME_API FCowQueryShape
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	ECowQueryShapeType Type = ECowQueryShapeType::Sphere;
+
+	// Sphere and box center, cone apex
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	FVector Origin = FVector::ZeroVector;
+
+	// Sphere radius, cone length
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	float Radius = 1000.f;
+
+	// Half size of the box (axis aligned)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	FVector Extent = FVector(500.0);
+
+	// Cone axis
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	FVector Direction = FVector::ForwardVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow", meta = (ClampMin = "0", ClampMax = "89.9"))
+	float HalfAngleDegrees = 45.f;
+
+	// Frustum is the camera view of this player, first local player if not set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cow")
+	TObjectPtr<APlayerController> Viewer = nullptr;
+};
+
 UCLASS()
 class COWRUNTIME_API UCowFunctionLibrary : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
 
 public:
+	// NodeGuid is the GUID of UK2Node_CowGetAllActorsOfClass that issued the call, used only for profiling (see CowTrace.h)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Utilities", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static void CowGetAllActorsOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, TArray<AActor*>& OutActors, FGuid NodeGuid = FGuid());
+
+	// OutActor is left untouched if there's no actor of the class (Blueprint out params start as None anyway)
+	// With more than one actor the result differs from earlier versions and the stock node: it's the first one in UCowActorIndexSubsystem
+	// order (bucket by bucket, removals swap actors within a bucket), not TActorIterator order. Don't rely on which one is returned
+	UFUNCTION(BlueprintCallable, Category = "Cow|Utilities", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static void CowGetActorOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, AActor*& OutActor, FGuid NodeGuid = FGuid());
+
+	// Actors of the class inside Shape, filtered over packed positions of UCowActorIndexSubsystem with Cow::Kernels
+	UFUNCTION(BlueprintCallable, Category = "Cow|Utilities", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static void CowGetAllActorsOfClassInShape(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const FCowQueryShape& Shape, TArray<AActor*>& OutActors, FGuid NodeGuid = FGuid());
+
+	// Registered components of the world, walks instances of ComponentClass (and its children) in memory instead of every actor of the world
+	// Instances of other worlds and unregistered ones are visited and filtered out, there is no index of registered components
 	UFUNCTION(BlueprintCallable, Category = "Cow|Utilities", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
-	static void CowGetAllActorsOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, TArray<AActor*>& OutActors);
+	static void CowGetAllComponentsOfClass(const UObject* WorldContextObject, TSoftClassPtr<UActorComponent> ComponentClass, TArray<UActorComponent*>& OutComponents, FGuid NodeGuid = FGuid());
 
+	// UWidgetBlueprintLibrary::GetAllWidgetsOfClass without TObjectIterator over every UUserWidget in memory
+	// TopLevelOnly returns only widgets added to the viewport
 	UFUNCTION(BlueprintCallable, Category = "Cow|Utilities", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
-	static void CowGetActorOfClass(const UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, AActor*& OutActor);
+	static void CowGetAllWidgetsOfClass(const UObject* WorldContextObject, TSoftClassPtr<UUserWidget> WidgetClass, TArray<UUserWidget*>& FoundWidgets, bool TopLevelOnly, FGuid NodeGuid = FGuid());
+
+	// Answered by FCowClassAncestry, neither class is loaded
+	UFUNCTION(BlueprintPure, Category = "Cow|Utilities", meta = (BlueprintInternalUseOnly = "true"))
+	static bool CowSoftClassIsChildOf(TSoftClassPtr<UObject> Class, TSoftClassPtr<UObject> ParentClass);
+
+	// Index of the first of Cases that Class is child of, INDEX_NONE if none (used by UK2Node_CowSwitchOnSoftClass)
+	UFUNCTION(BlueprintPure, Category = "Cow|Utilities", meta = (BlueprintInternalUseOnly = "true"))
+	static int32 CowSwitchOnSoftClass(TSoftClassPtr<UObject> Class, const TArray<TSoftClassPtr<UObject>>& Cases);
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CowLoadAssetsAsyncAction.generated.h"
+
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnLoadAssetsProgress, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnAssetsLoaded, const TArray<UObject*>&, Objects);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnClassesLoaded, const TArray<UClass*>&, Classes);
+
+/**
+ * Runtime part of UK2Node_CowLoadAssets
+ *
+ * All assets are loaded with a single FStreamableManager request (instead of a LoadAsset node per asset),
+ * so they are loaded in parallel and completion is reported once
+ * OnProgress is broadcast every time the request makes progress (see FStreamableHandle::BindUpdateDelegate)
+ *
+ * Soft object and soft class arrays are handled by UCowLoadAssetsAsyncAction and UCowLoadClassesAsyncAction,
+ * the only difference is the type of Completed
+ */
+UCLASS(Abstract)
+class COWRUNTIME_API UCowLoadAsyncActionBase : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Activate() override;
+	virtual void BeginDestroy() override;
+
+	// Progress of the request in [0, 1]
+	UPROPERTY(BlueprintAssignable)
+	FCowOnLoadAssetsProgress OnProgress;
+
+protected:
+	void Init(UObject* InWorldContextObject, TArray<FSoftObjectPath>&& InPaths, int32 InPriority, const FGuid& InNodeGuid);
+
+	// Paths.Num() objects (nullptr for failed or null entries)
+	virtual void BroadcastCompleted(const TArray<UObject*>& Objects) PURE_VIRTUAL(UCowLoadAsyncActionBase::BroadcastCompleted, );
+
+private:
+	void OnLoadUpdate(TSharedRef<FStreamableHandle> Handle);
+	void OnLoadCompleted();
+
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TArray<FSoftObjectPath> Paths;
+	int32 Priority = 0;
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	FGuid NodeGuid;
+	// Activation time, start of Cow.AsyncRequest trace event
+	uint64 RequestCycle = 0;
+
+	// Non zero while the request is in flight (see STAT_Cow_PendingAssetLoads)
+	int32 PendingCount = 0;
+};
+
+UCLASS()
+class COWRUNTIME_API UCowLoadAssetsAsyncAction : public UCowLoadAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// Priority is FStreamableManager priority (0 is default, 100 is AsyncLoadHighPriority)
+	// NodeGuid is the GUID of UK2Node_CowLoadAssets that issued the call, used only for profiling (see CowTrace.h)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Loading", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowLoadAssetsAsyncAction* CowLoadAssets(UObject* WorldContextObject, const TArray<TSoftObjectPtr<UObject>>& Assets, int32 Priority, FGuid NodeGuid);
+
+	// Objects are in the same order as Assets
+	UPROPERTY(BlueprintAssignable)
+	FCowOnAssetsLoaded Completed;
+
+protected:
+	virtual void BroadcastCompleted(const TArray<UObject*>& Objects) override;
+};
+
+UCLASS()
+class COWRUNTIME_API UCowLoadClassesAsyncAction : public UCowLoadAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// Same as UCowLoadAssetsAsyncAction::CowLoadAssets for soft class references
+	UFUNCTION(BlueprintCallable, Category = "Cow|Loading", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowLoadClassesAsyncAction* CowLoadClasses(UObject* WorldContextObject, const TArray<TSoftClassPtr<UObject>>& SoftClasses, int32 Priority, FGuid NodeGuid);
+
+	// Classes are in the same order as SoftClasses
+	UPROPERTY(BlueprintAssignable)
+	FCowOnClassesLoaded Completed;
+
+protected:
+	virtual void BroadcastCompleted(const TArray<UObject*>& Objects) override;
+};
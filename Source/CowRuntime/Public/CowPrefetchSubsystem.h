@@ -0,0 +1,50 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "CowPrefetchSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Loads soft references of Cow nodes a map is likely to use (see FCowSoftReferenceManifest) with a single streamable request
+ *
+ * With cow.Prefetch.OnPreLoadMap 1 (default) it's done automatically when travel starts, so the classes are loaded together with the map
+ * instead of making the first CowCreateWidgetAsync/CowSpawnActorAsync after BeginPlay wait for them
+ * The handle is kept until the next map is prefetched, so the classes stay loaded while the map is played
+ *
+ * Maps without the tag (not saved since the plugin was updated) are simply skipped
+ */
+UCLASS()
+class COWRUNTIME_API UCowPrefetchSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Starts loading Cow soft references of MapName (long package name, e.g. /Game/Maps/Arena), replaces the previous prefetch
+	 * Priority is FStreamableManager priority (0 is default, 100 is AsyncLoadHighPriority)
+	 *
+	 * @return Number of requested references, 0 if the map has none
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Cow|Loading")
+	int32 PrefetchMap(const FString& MapName, int32 Priority = 0);
+
+	// Drops the handle, prefetched classes can be garbage collected if nothing else uses them
+	UFUNCTION(BlueprintCallable, Category = "Cow|Loading")
+	void ReleasePrefetch();
+
+	TSharedPtr<FStreamableHandle> GetPrefetchHandle() const { return PrefetchHandle; }
+
+private:
+	void OnPreLoadMap(const FString& MapName);
+
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+	FName PrefetchedMap;
+	FDelegateHandle PreLoadMapHandle;
+};
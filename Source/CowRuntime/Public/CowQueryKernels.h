@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FConvexVolume;
+struct FMinimalViewInfo;
+
+/**
+ * Shape filters over packed actor positions (see TCowActorChunk), 4 actors per iteration with VectorRegister4Float
+ * (SSE/NEON, whatever UE math is compiled for), scalar loop handles the tail
+ *
+ * Sphere, box and cone test the location, frustum tests the bounds sphere the same way view culling does
+ * Unplaced actors (no root component) never pass any of them
+ *
+ * Scalar versions do the same math one actor at a time, they're the reference for CowActorQueryBenchmark
+ */
+namespace Cow::Kernels
+{
+	// Coordinate of positions that must never pass a test, squared it still fits a float
+	inline constexpr float UnplacedCoordinate = 1e18f;
+	// Radius of unplaced positions, fails frustum test wherever the view looks
+	inline constexpr float UnplacedRadius = -UE_BIG_NUMBER;
+
+	// Parallel arrays, Radius is needed only by frustum
+	struct FPositions
+	{
+		const float* X = nullptr;
+		const float* Y = nullptr;
+		const float* Z = nullptr;
+		const float* Radius = nullptr;
+		int32 Num = 0;
+
+		FPositions Slice(int32 Start, int32 Count) const
+		{
+			return { X + Start, Y + Start, Z + Start, Radius + Start, Count };
+		}
+	};
+
+	struct FSphere
+	{
+		FVector3f Center = FVector3f::ZeroVector;
+		float Radius = 0.f;
+	};
+
+	// Axis aligned
+	struct FBox
+	{
+		FVector3f Min = FVector3f::ZeroVector;
+		FVector3f Max = FVector3f::ZeroVector;
+	};
+
+	struct FCone
+	{
+		FVector3f Apex = FVector3f::ZeroVector;
+		// Normalized
+		FVector3f Direction = FVector3f::ForwardVector;
+		float Length = 0.f;
+		// Below 90 degrees
+		float HalfAngleRadians = 0.f;
+	};
+
+	// Planes point outwards (FConvexVolume convention)
+	struct FFrustum
+	{
+		TArray<FPlane4f, TInlineAllocator<6>> Planes;
+	};
+
+	COWRUNTIME_API FSphere MakeSphere(const FVector& Center, double Radius);
+	COWRUNTIME_API FBox MakeBox(const FVector& Center, const FVector& Extent);
+	COWRUNTIME_API FCone MakeCone(const FVector& Apex, const FVector& Direction, double Length, double HalfAngleDegrees);
+	COWRUNTIME_API FFrustum MakeFrustum(const FConvexVolume& Volume);
+	// Frustum of the camera view (no far plane, same as GetViewFrustumBounds with a perspective projection)
+	COWRUNTIME_API FFrustum MakeFrustum(const FMinimalViewInfo& View);
+
+	/**
+	 * Write indices of positions inside the shape to OutIndices (room for Positions.Num is required), return how many
+	 * Indices are ascending
+	 */
+	COWRUNTIME_API int32 Filter(const FPositions& Positions, const FSphere& Shape, int32* OutIndices);
+	COWRUNTIME_API int32 Filter(const FPositions& Positions, const FBox& Shape, int32* OutIndices);
+	COWRUNTIME_API int32 Filter(const FPositions& Positions, const FCone& Shape, int32* OutIndices);
+	COWRUNTIME_API int32 Filter(const FPositions& Positions, const FFrustum& Shape, int32* OutIndices);
+
+	namespace Scalar
+	{
+		COWRUNTIME_API int32 Filter(const FPositions& Positions, const FSphere& Shape, int32* OutIndices);
+		COWRUNTIME_API int32 Filter(const FPositions& Positions, const FBox& Shape, int32* OutIndices);
+		COWRUNTIME_API int32 Filter(const FPositions& Positions, const FCone& Shape, int32* OutIndices);
+		COWRUNTIME_API int32 Filter(const FPositions& Positions, const FFrustum& Shape, int32* OutIndices);
+	}
+
+	// Calls Func(int32 Index) for every position inside Shape, filtered in blocks so indices stay on the stack
+	template<typename ShapeType, typename FuncType>
+	void ForEachInside(const FPositions& Positions, const ShapeType& Shape, FuncType&& Func)
+	{
+		constexpr int32 BlockSize = 256;
+		int32 Indices[BlockSize];
+		for (int32 Start = 0; Start < Positions.Num; Start += BlockSize)
+		{
+			const int32 Count = Filter(Positions.Slice(Start, FMath::Min(BlockSize, Positions.Num - Start)), Shape, Indices);
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Func(Start + Indices[Index]);
+			}
+		}
+	}
+}
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Soft references of Cow nodes that load something (CowCreateWidgetAsync, CowSpawnActorAsync, CowSpawnActorsBatched,
+ * CowConstructObjectAsync and CowLoadAssets), stored as asset registry tag of the asset that owns the nodes
+ *
+ * Cow nodes keep soft references on purpose, so cooker, chunking rules and asset manager have no idea the classes are related
+ * to Blueprints and maps that use them. The tag is written by CowNodes editor module whenever the asset is saved or cooked
+ * (see FCowSoftReferenceCollector) and is read at runtime by UCowPrefetchSubsystem
+ *
+ * Tag of a map also has references of Blueprint actors placed in it (and of their parent Blueprints)
+ */
+namespace FCowSoftReferenceManifest
+{
+	inline const FName TagName = TEXT("CowSoftReferences");
+
+	// Asset bundle of maps with UCowNodesSettings::bRegisterAssetBundles
+	inline const FName BundleName = TEXT("Cow");
+
+	// Sorted and deduplicated, so the tag doesn't change when nodes are just moved around
+	COWRUNTIME_API FString MakeTagValue(TArray<FSoftObjectPath> Paths);
+	COWRUNTIME_API void ParseTagValue(const FString& Value, TArray<FSoftObjectPath>& OutPaths);
+
+	// Reads the tag of PackageName (Blueprint or map) from asset registry, false if there is no tag
+	COWRUNTIME_API bool GetSoftReferences(FName PackageName, TArray<FSoftObjectPath>& OutPaths);
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CowAsyncLoadQueue.h"
+#include "CowSpawnActorAsyncAction.generated.h"
+
+class AActor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnActorSpawned, AActor*, Actor);
+
+/**
+ * Runtime part of UK2Node_CowSpawnActorAsync
+ *
+ * Loads the class and does the same BeginDeferredActorSpawnFromClass -> FinishSpawningActor pair stock SpawnActorFromClass expands to
+ * ExposeOnSpawn assignments are generated by the node after BeginSpawn, which is broadcast between the two calls
+ * (so assigned values are visible in construction script and BeginPlay the same way they are with SpawnActorFromClass)
+ *
+ * Finishing the spawn natively keeps SpawnTransform evaluated only once, when the action is created
+ */
+UCLASS()
+class COWRUNTIME_API UCowSpawnActorAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// NodeGuid is the GUID of UK2Node_CowSpawnActorAsync that issued the call, used only for profiling (see CowTrace.h)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Actor", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowSpawnActorAsyncAction* CowSpawnActorAsync(UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const FTransform& SpawnTransform,
+		ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, AActor* Owner, FGuid NodeGuid, ESpawnActorScaleMethod TransformScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot);
+
+	virtual void Activate() override;
+	virtual void BeginDestroy() override;
+
+	// Actor is spawned deferred (construction script didn't run yet), never broadcast if the class failed to load or spawn failed
+	UPROPERTY(BlueprintAssignable)
+	FCowOnActorSpawned BeginSpawn;
+
+	// Spawn is finished, Actor is nullptr if the class failed to load or spawn failed
+	UPROPERTY(BlueprintAssignable)
+	FCowOnActorSpawned Completed;
+
+private:
+	void OnActorClassLoaded();
+
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TSoftClassPtr<AActor> ActorClass;
+	FTransform SpawnTransform;
+	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::Undefined;
+	ESpawnActorScaleMethod TransformScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot;
+	TWeakObjectPtr<AActor> Owner;
+	FCowAsyncLoadQueue::FRequestId LoadRequestId = 0;
+	FGuid NodeGuid;
+	// Activation time, start of Cow.AsyncRequest trace event
+	uint64 RequestCycle = 0;
+};
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CowAsyncLoadQueue.h"
+#include "CowSpawnActorsBatchedAction.generated.h"
+
+class AActor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FCowOnBatchedActorSpawned, AActor*, Actor, int32, Index);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCowOnBatchedActorsSpawned, const TArray<AActor*>&, Actors);
+
+/**
+ * Runtime part of UK2Node_CowSpawnActorsBatched
+ *
+ * Loads the class once and spawns one actor per SpawnTransforms element spread over several frames,
+ * every frame spawning stops as soon as cow.SpawnBatched.FrameBudgetMs is used up
+ * The budget is shared by all batched actions (and includes time spent in BeginSpawn/Spawned handlers),
+ * every batch spawns at least one instance per frame even if the budget is used up, so no batch is starved by the others
+ * (with many batches in flight a frame may go over the budget by one instance per batch)
+ *
+ * Per instance flow is the same as UCowSpawnActorAsyncAction: BeginSpawn (assignments) -> FinishSpawningActor -> Spawned
+ * Index is the index in SpawnTransforms, pure nodes linked to ExposeOnSpawn pins are evaluated per instance so it can be used
+ * to pick per instance data (e.g. Get(Array, Index))
+ */
+UCLASS()
+class COWRUNTIME_API UCowSpawnActorsBatchedAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// NodeGuid is the GUID of UK2Node_CowSpawnActorsBatched that issued the call, used only for profiling (see CowTrace.h)
+	UFUNCTION(BlueprintCallable, Category = "Cow|Actor", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UCowSpawnActorsBatchedAction* CowSpawnActorsBatched(UObject* WorldContextObject, TSoftClassPtr<AActor> ActorClass, const TArray<FTransform>& SpawnTransforms,
+		ESpawnActorCollisionHandlingMethod CollisionHandlingOverride, AActor* Owner, FGuid NodeGuid, ESpawnActorScaleMethod TransformScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot);
+
+	virtual void Activate() override;
+	virtual void BeginDestroy() override;
+
+	// Actor is spawned deferred (construction script didn't run yet)
+	UPROPERTY(BlueprintAssignable)
+	FCowOnBatchedActorSpawned BeginSpawn;
+
+	// Spawn of the instance is finished, not broadcast for instances that failed to spawn
+	UPROPERTY(BlueprintAssignable)
+	FCowOnBatchedActorSpawned Spawned;
+
+	// All instances are processed, Actors matches SpawnTransforms (nullptr for instances that failed to spawn or if the class failed to load)
+	UPROPERTY(BlueprintAssignable)
+	FCowOnBatchedActorsSpawned Completed;
+
+private:
+	void OnActorClassLoaded();
+	void SpawnPendingInstances();
+	AActor* SpawnInstance(UObject* Context, UClass* Class, int32 Index);
+	void Finish();
+
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TSoftClassPtr<AActor> ActorClass;
+	TArray<FTransform> SpawnTransforms;
+	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::Undefined;
+	ESpawnActorScaleMethod TransformScaleMethod = ESpawnActorScaleMethod::MultiplyWithRoot;
+	TWeakObjectPtr<AActor> Owner;
+	FCowAsyncLoadQueue::FRequestId LoadRequestId = 0;
+	FGuid NodeGuid;
+	// Activation time, start of Cow.AsyncRequest trace event
+	uint64 RequestCycle = 0;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> SpawnedActors;
+
+	// Index of the next instance to spawn, instances in [NextIndex, Num) are counted in STAT_Cow_PendingBatchedSpawns
+	int32 NextIndex = 0;
+	bool bPendingCounted = false;
+};
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "UObject/ObjectKey.h"
+
+#define COW_STATS_ENABLED (!UE_BUILD_SHIPPING)
+
+// stat Cow
+DECLARE_STATS_GROUP(TEXT("Cow"), STATGROUP_Cow, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowGetAllActorsOfClass"), STAT_Cow_GetAllActorsOfClass, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowGetActorOfClass"), STAT_Cow_GetActorOfClass, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowGetAllActorsOfClassInShape"), STAT_Cow_GetAllActorsOfClassInShape, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowGetAllComponentsOfClass"), STAT_Cow_GetAllComponentsOfClass, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowGetAllWidgetsOfClass"), STAT_Cow_GetAllWidgetsOfClass, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowCreateWidgetAsync Create"), STAT_Cow_CreateWidget, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowSpawnActorAsync Spawn"), STAT_Cow_SpawnActor, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CowConstructObjectAsync Construct"), STAT_Cow_ConstructObject, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Soft class ancestry"), STAT_Cow_ClassAncestry, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Actor index build"), STAT_Cow_ActorIndexBuild, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Actor index positions refresh"), STAT_Cow_ActorIndexPositions, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors scanned"), STAT_Cow_ActorsScanned, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query memo hits"), STAT_Cow_QueryMemoHits, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query memo misses"), STAT_Cow_QueryMemoMisses, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending widget loads"), STAT_Cow_PendingWidgetLoads, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending batched spawns"), STAT_Cow_PendingBatchedSpawns, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending asset loads"), STAT_Cow_PendingAssetLoads, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending class loads"), STAT_Cow_PendingClassLoads, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coalesced class loads"), STAT_Cow_CoalescedClassLoads, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Held background loads"), STAT_Cow_HeldBackgroundLoads, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Call site stats"), STAT_Cow_CallSiteMemory, STATGROUP_Cow, COWRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query output bytes"), STAT_Cow_QueryOutputBytes, STATGROUP_Cow, COWRUNTIME_API);
+
+#if COW_STATS_ENABLED
+
+enum class ECowCallSiteKind : uint8
+{
+	GetAllActorsOfClass,
+	GetActorOfClass,
+	CreateWidgetAsync,
+	GetAllComponentsOfClass,
+	GetAllWidgetsOfClass,
+	GetAllActorsOfClassInShape
+};
+
+/**
+ * Per call site counters of Cow runtime, dumped by "cow.Stats" console command
+ *
+ * Call site is the node GUID baked in at ExpandNode time (see FCowCompilerUtilities::NodeGuidParamName), so a node inherited
+ * by Blueprint subclasses is a single call site. Its asset is the closest common parent of the classes that called it,
+ * which is the Blueprint that contains the node once the parent itself (or two different children) called it
+ * C++ callers have no GUID and are told apart by their class instead
+ *
+ * CowCreateWidgetAsync is measured only with compact code generation, legacy LoadAsset expansion has no runtime part to record it
+ *
+ * Game thread only, disabled with cow.Stats.Enable 0
+ */
+class COWRUNTIME_API FCowCallSiteStats
+{
+public:
+	static FCowCallSiteStats& Get();
+	static bool IsEnabled();
+
+	void RecordActorQuery(ECowCallSiteKind Kind, const FGuid& NodeGuid, const UObject* Caller, uint64 Cycles, int32 ActorsScanned);
+
+	// Widget requests are keyed by the caller class captured when the request is made,
+	// the caller itself may be gone by the time the request completes or is cancelled
+	void RecordWidgetRequest(const FGuid& NodeGuid, const UClass* CallerClass);
+	// LatencyCycles from request to completion, CreateCycles spent creating the widget instance
+	void RecordWidgetCompleted(const FGuid& NodeGuid, const UClass* CallerClass, uint64 LatencyCycles, uint64 CreateCycles);
+	// Request was destroyed before the class finished loading
+	void RecordWidgetCancelled(const FGuid& NodeGuid, const UClass* CallerClass);
+
+	enum class ESortBy : uint8
+	{
+		Time,
+		Calls,
+		// Average per call, total would put busy cheap call sites above rare expensive ones
+		Scanned,
+		Pending
+	};
+	void Dump(FOutputDevice& Ar, int32 TopCount, ESortBy SortBy) const;
+	void Reset();
+
+private:
+	struct FKey
+	{
+		ECowCallSiteKind Kind;
+		FGuid NodeGuid;
+		// Only for calls without NodeGuid (C++)
+		TObjectKey<UClass> CallerClass;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Kind == Other.Kind && NodeGuid == Other.NodeGuid && CallerClass == Other.CallerClass;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.NodeGuid), GetTypeHash(Key.CallerClass)), static_cast<uint32>(Key.Kind));
+		}
+	};
+
+	struct FCallSite
+	{
+		// Closest common parent of the callers so far, CallerName is updated whenever it changes (class may be gone by the time of the dump)
+		TWeakObjectPtr<const UClass> CallerClass;
+		FString CallerName;
+		int64 Calls = 0;
+		uint64 Cycles = 0;
+		int64 ActorsScanned = 0;
+		int32 Pending = 0;
+		uint64 LatencyCycles = 0;
+		int64 Completed = 0;
+	};
+
+	FCallSite* FindOrAdd(ECowCallSiteKind Kind, const FGuid& NodeGuid, const UClass* CallerClass);
+
+	TMap<FKey, FCallSite> CallSites;
+};
+
+#define COW_STATS_RECORD_ACTOR_QUERY(Kind, NodeGuid, Caller, Cycles, ActorsScanned) \
+	do { if (FCowCallSiteStats::IsEnabled()) { FCowCallSiteStats::Get().RecordActorQuery(Kind, NodeGuid, Caller, Cycles, ActorsScanned); } } while (0)
+#define COW_STATS_RECORD_WIDGET_REQUEST(NodeGuid, CallerClass) \
+	do { if (FCowCallSiteStats::IsEnabled()) { FCowCallSiteStats::Get().RecordWidgetRequest(NodeGuid, CallerClass); } } while (0)
+#define COW_STATS_RECORD_WIDGET_COMPLETED(NodeGuid, CallerClass, LatencyCycles, CreateCycles) \
+	do { if (FCowCallSiteStats::IsEnabled()) { FCowCallSiteStats::Get().RecordWidgetCompleted(NodeGuid, CallerClass, LatencyCycles, CreateCycles); } } while (0)
+#define COW_STATS_RECORD_WIDGET_CANCELLED(NodeGuid, CallerClass) \
+	do { if (FCowCallSiteStats::IsEnabled()) { FCowCallSiteStats::Get().RecordWidgetCancelled(NodeGuid, CallerClass); } } while (0)
+
+#else
+
+#define COW_STATS_RECORD_ACTOR_QUERY(Kind, NodeGuid, Caller, Cycles, ActorsScanned) do { } while (0)
+#define COW_STATS_RECORD_WIDGET_REQUEST(NodeGuid, CallerClass) do { } while (0)
+#define COW_STATS_RECORD_WIDGET_COMPLETED(NodeGuid, CallerClass, LatencyCycles, CreateCycles) do { } while (0)
+#define COW_STATS_RECORD_WIDGET_CANCELLED(NodeGuid, CallerClass) do { } while (0)
+
+#endif
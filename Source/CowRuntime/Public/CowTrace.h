@@ -0,0 +1,57 @@
+// Copyright (c) 2026 Oleksandr "sleepCOW" Ozerov. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#define COW_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if COW_TRACE_ENABLED
+
+/**
+ * Insights events of Cow runtime (enable with -trace=cpu,cow)
+ *
+ * Every event carries NodeGuid of the Blueprint node that issued the call (baked in by the node at ExpandNode time),
+ * so a slow query in a capture can be found in the graph with "Find in Blueprints" by the GUID
+ * Events of native callers have zero NodeGuid
+ *
+ * Cow.ActorQuery		- CowGetAllActorsOfClass/CowGetActorOfClass/CowGetAllComponentsOfClass/CowGetAllWidgetsOfClass (class path, objects scanned and returned, start/end cycles)
+ * Cow.WidgetLoadStart	- CowCreateWidgetAsync requested widget class load
+ * Cow.WidgetLoadEnd	- widget class load finished (bLoaded false if class failed to load)
+ * Cow.WidgetCreate		- widget instance creation (start/end cycles)
+ * Cow.AsyncRequest		- CowSpawnActorAsync/CowSpawnActorsBatched/CowConstructObjectAsync/CowLoadAssets from activation to completion
+ *						  (path of the class or first asset, objects produced, start/end cycles)
+ */
+UE_TRACE_CHANNEL_EXTERN(CowChannel, COWRUNTIME_API);
+
+struct COWRUNTIME_API FCowTrace
+{
+	static void OutputActorQuery(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, uint64 StartCycle, uint64 EndCycle, int32 ActorsScanned, int32 ActorsReturned);
+	static void OutputWidgetLoadStart(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath);
+	static void OutputWidgetLoadEnd(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, bool bLoaded);
+	static void OutputWidgetCreate(const FGuid& NodeGuid, const FSoftObjectPath& ClassPath, uint64 StartCycle, uint64 EndCycle);
+	static void OutputAsyncRequest(const FGuid& NodeGuid, const FSoftObjectPath& Path, uint64 StartCycle, uint64 EndCycle, int32 NumObjects);
+};
+
+#define TRACE_COW_ACTOR_QUERY(NodeGuid, ClassPath, StartCycle, EndCycle, ActorsScanned, ActorsReturned) \
+	FCowTrace::OutputActorQuery(NodeGuid, ClassPath, StartCycle, EndCycle, ActorsScanned, ActorsReturned);
+#define TRACE_COW_WIDGET_LOAD_START(NodeGuid, ClassPath) \
+	FCowTrace::OutputWidgetLoadStart(NodeGuid, ClassPath);
+#define TRACE_COW_WIDGET_LOAD_END(NodeGuid, ClassPath, bLoaded) \
+	FCowTrace::OutputWidgetLoadEnd(NodeGuid, ClassPath, bLoaded);
+#define TRACE_COW_WIDGET_CREATE(NodeGuid, ClassPath, StartCycle, EndCycle) \
+	FCowTrace::OutputWidgetCreate(NodeGuid, ClassPath, StartCycle, EndCycle);
+#define TRACE_COW_ASYNC_REQUEST(NodeGuid, Path, StartCycle, EndCycle, NumObjects) \
+	FCowTrace::OutputAsyncRequest(NodeGuid, Path, StartCycle, EndCycle, NumObjects);
+
+#else
+
+#define TRACE_COW_ACTOR_QUERY(NodeGuid, ClassPath, StartCycle, EndCycle, ActorsScanned, ActorsReturned)
+#define TRACE_COW_WIDGET_LOAD_START(NodeGuid, ClassPath)
+#define TRACE_COW_WIDGET_LOAD_END(NodeGuid, ClassPath, bLoaded)
+#define TRACE_COW_WIDGET_CREATE(NodeGuid, ClassPath, StartCycle, EndCycle)
+#define TRACE_COW_ASYNC_REQUEST(NodeGuid, Path, StartCycle, EndCycle, NumObjects)
+
+#endif